@@ -16,6 +16,7 @@
 %{
   //#include <airflow/ReverseTranslator.hpp>
   #include <airflow/contam/ForwardTranslator.hpp>
+  #include <airflow/contam/AirflowSolver.hpp>
   using namespace openstudio::contam;
   using namespace openstudio;
 
@@ -25,6 +26,7 @@
 
 %ignore IndexModelImpl;
 %ignore IndexModel(Reader &input);
+%ignore openstudio::contam::IndexModel::airflowElement;
 %template(OptionalContamIndexModel) boost::optional<openstudio::contam::IndexModel>;
 
 // All the vectors
@@ -55,6 +57,7 @@
 %include <airflow/contam/PrjObjects.hpp>
 %include <airflow/contam/PrjAirflowElements.hpp>
 %include <airflow/contam/PrjModel.hpp>
+%include <airflow/contam/AirflowSolver.hpp>
 //%include <airflow/ReverseTranslator.hpp>
 %include <airflow/contam/ForwardTranslator.hpp>
 
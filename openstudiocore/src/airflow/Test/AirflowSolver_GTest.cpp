@@ -0,0 +1,279 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/AirflowSolver.hpp"
+#include "../contam/PrjModel.hpp"
+#include "../contam/PrjAirflowElements.hpp"
+
+#include "../../utilities/time/DateTime.hpp"
+
+#include <cmath>
+
+// One zone with two identical leaks to ambient at different heights, driven only by stack effect
+TEST_F(AirflowFixture, AirflowSolver_StackEffect) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Zone_0");
+  zone.setPl(1);
+  model.addZone(zone);
+  openstudio::contam::PlrTest1 leak(OPNG, "external", "This is the average leakage element for exterior walls",
+    6.13696e-008, 0.000499082, 0.65, 75, 0.00906345);
+  model.addAirflowElement(leak);
+  openstudio::contam::AirflowPath low(0, 1, 1, 0, 1, 0.0, 1.0, 0.0, 0.0, 0.0, 0);
+  openstudio::contam::AirflowPath high(0, 1, 1, 0, 1, 3.0, 1.0, 0.0, 0.0, 0.0, 0);
+  model.addAirflowPath(low);
+  model.addAirflowPath(high);
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(273.15, 101325.0, 0.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  // Cold air enters at the bottom and leaves at the top, and the zone mass balance closes
+  std::vector<double> flows = solver.pathFlows();
+  ASSERT_EQ(2u, flows.size());
+  EXPECT_LT(flows[0], 0.0);
+  EXPECT_GT(flows[1], 0.0);
+  EXPECT_NEAR(0.0, flows[0] + flows[1], 1.0e-5);
+  ASSERT_EQ(1u, solver.zonePressures().size());
+  // With the neutral plane at mid height the zone is depressurized at floor level
+  EXPECT_GT(0.0, solver.zonePressures()[0]);
+}
+
+// A constant mass flow supply balanced by a single leak has a closed form solution
+TEST_F(AirflowFixture, AirflowSolver_SupplyAndLeak) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Zone_0");
+  zone.setPl(1);
+  model.addZone(zone);
+  openstudio::contam::PlrTest1 leak(OPNG, "external", "This is the average leakage element for exterior walls",
+    6.13696e-008, 0.000499082, 0.65, 75, 0.00906345);
+  openstudio::contam::AfeCmf supply(0, 0, "supply", "Constant supply fan", 0.01, 0);
+  model.addAirflowElement(leak);
+  model.addAirflowElement(supply);
+  openstudio::contam::AirflowPath exterior(0, 1, 1, 0, 1, 0.0, 1.0, 0.0, 0.0, 0.0, 0);
+  openstudio::contam::AirflowPath fan(0, -1, 1, 2, 1, 0.0, 1.0, 0);
+  model.addAirflowPath(exterior);
+  model.addAirflowPath(fan);
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 0.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  double rho = 101325.0/(287.055*293.15);
+  double dP = std::pow(0.01/(0.000499082*std::sqrt(rho)), 1.0/0.65);
+  ASSERT_EQ(2u, solver.pathFlows().size());
+  EXPECT_NEAR(0.01, solver.pathFlows()[0], 1.0e-6);
+  EXPECT_NEAR(0.01, solver.pathFlows()[1], 1.0e-12);
+  ASSERT_EQ(1u, solver.zonePressures().size());
+  EXPECT_NEAR(dP, solver.zonePressures()[0], 1.0e-3*dP);
+  EXPECT_NEAR(dP, solver.pathDeltaPs()[0], 1.0e-3*dP);
+
+  // Repeat for a short series of identical conditions
+  std::vector<openstudio::DateTime> dateTimes;
+  dateTimes.push_back(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1, 2009), openstudio::Time(0, 1)));
+  dateTimes.push_back(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1, 2009), openstudio::Time(0, 2)));
+  ASSERT_TRUE(solver.run(dateTimes, std::vector<openstudio::contam::WeatherData>(2, weather)));
+  boost::optional<openstudio::TimeSeries> pressure = solver.nodePressure(1);
+  ASSERT_TRUE(pressure);
+  ASSERT_EQ(2u, pressure->values().size());
+  EXPECT_NEAR(dP, pressure->values()[1], 1.0e-3*dP);
+  EXPECT_FALSE(solver.pathFlow(3));
+}
+
+// A constant mass flow supply balanced by a quadratic leak, dP = a*Q + b*Q^2
+TEST_F(AirflowFixture, AirflowSolver_Quadratic) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Zone_0");
+  zone.setPl(1);
+  model.addZone(zone);
+  double a = 100.0;
+  double b = 10000.0;
+  openstudio::contam::QfrQab leak(0, 0, "quadratic", "Quadratic volume flow leak", a, b);
+  openstudio::contam::AfeCmf supply(0, 0, "supply", "Constant supply fan", 0.01, 0);
+  model.addAirflowElement(leak);
+  model.addAirflowElement(supply);
+  openstudio::contam::AirflowPath exterior(0, 1, 1, 0, 1, 0.0, 1.0, 0.0, 0.0, 0.0, 0);
+  openstudio::contam::AirflowPath fan(0, -1, 1, 2, 1, 0.0, 1.0, 0);
+  model.addAirflowPath(exterior);
+  model.addAirflowPath(fan);
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 0.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  double rho = 101325.0/(287.055*293.15);
+  double Q = 0.01/rho;
+  double dP = a*Q + b*Q*Q;
+  ASSERT_EQ(2u, solver.pathFlows().size());
+  EXPECT_NEAR(0.01, solver.pathFlows()[0], 1.0e-6);
+  ASSERT_EQ(1u, solver.zonePressures().size());
+  EXPECT_NEAR(dP, solver.zonePressures()[0], 1.0e-3*dP);
+}
+
+// A fan with a straight line curve from shut-off to free delivery, balanced by a linear leak
+TEST_F(AirflowFixture, AirflowSolver_Fan) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Zone_0");
+  zone.setPl(1);
+  model.addZone(zone);
+  double a = 100.0;
+  double sop = 100.0;
+  double fdf = 0.1;
+  double rdens = 1.2041;
+  openstudio::contam::QfrQab leak(0, 0, "linear", "Linear volume flow leak", a, 0.0);
+  openstudio::contam::AfeFan supply(0, 0, "fan", "Supply fan", 1.0e-4, 0.01, 0.5, rdens, fdf, sop, 0.0,
+    std::vector<double>(4, 0.0), 0.0, 0, std::vector<openstudio::contam::FanDataPoint>());
+  model.addAirflowElement(leak);
+  model.addAirflowElement(supply);
+  openstudio::contam::AirflowPath exterior(0, 1, 1, 0, 1, 0.0, 1.0, 0.0, 0.0, 0.0, 0);
+  openstudio::contam::AirflowPath fan(0, -1, 1, 2, 1, 0.0, 1.0, 0);
+  model.addAirflowPath(exterior);
+  model.addAirflowPath(fan);
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 0.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  // Fan: F = ratio*fdf*(1 - P/(ratio*sop)), leak: F = rho*P/a
+  double rho = 101325.0/(287.055*293.15);
+  double ratio = rho/rdens;
+  double P = ratio*fdf/(fdf/sop + rho/a);
+  double F = rho*P/a;
+  ASSERT_EQ(2u, solver.pathFlows().size());
+  EXPECT_NEAR(F, solver.pathFlows()[0], 1.0e-6);
+  EXPECT_NEAR(F, solver.pathFlows()[1], 1.0e-6);
+  ASSERT_EQ(1u, solver.zonePressures().size());
+  EXPECT_NEAR(P, solver.zonePressures()[0], 1.0e-3*P);
+}
+
+// Wind on opposite walls with identical linear leaks puts the zone halfway between the wall pressures
+TEST_F(AirflowFixture, AirflowSolver_WindPressure) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone zone(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Zone_0");
+  zone.setPl(1);
+  model.addZone(zone);
+  double a = 100.0;
+  openstudio::contam::QfrQab leak(0, 0, "linear", "Linear volume flow leak", a, 0.0);
+  model.addAirflowElement(leak);
+  std::vector<openstudio::contam::PressureCoefficientPoint> coeffs;
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(0.0, 0.6));
+  coeffs.push_back(openstudio::contam::PressureCoefficientPoint(180.0, -0.3));
+  std::vector<openstudio::contam::WindPressureProfile> profiles;
+  profiles.push_back(openstudio::contam::WindPressureProfile(1, 0, "walls", "Opposite walls", coeffs));
+  model.setWindPressureProfiles(profiles);
+  openstudio::contam::AirflowPath windward(openstudio::contam::WIND, 1, 1, 1, 1, 0.0, 1.0, 0.0, 1.0, 0.0, 0);
+  openstudio::contam::AirflowPath leeward(openstudio::contam::WIND, 1, 1, 1, 1, 0.0, 1.0, 0.0, 1.0, 180.0, 0);
+  model.addAirflowPath(windward);
+  model.addAirflowPath(leeward);
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 10.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  double rho = 101325.0/(287.055*293.15);
+  double pWindward = 0.5*rho*10.0*10.0*0.6;
+  double pLeeward = 0.5*rho*10.0*10.0*(-0.3);
+  double P = 0.5*(pWindward + pLeeward);
+  double F = rho*(P - pWindward)/a;
+  ASSERT_EQ(2u, solver.pathFlows().size());
+  EXPECT_NEAR(F, solver.pathFlows()[0], 1.0e-6);
+  EXPECT_NEAR(-F, solver.pathFlows()[1], 1.0e-6);
+  ASSERT_EQ(1u, solver.zonePressures().size());
+  EXPECT_NEAR(P, solver.zonePressures()[0], 1.0e-3*P);
+}
+
+// A simple air handling system supplying more than it returns, the excess leaves through a linear leak
+TEST_F(AirflowFixture, AirflowSolver_Ahs) {
+  openstudio::contam::IndexModel model;
+  openstudio::contam::Level level(3.0, "Level_0");
+  model.addLevel(level);
+  openstudio::contam::Zone room(openstudio::contam::ZoneFlags::VAR_P, 300, 293.15, "Room");
+  room.setPl(1);
+  model.addZone(room);
+  openstudio::contam::Zone returnZone(0, 0.0, 293.15, "AHS(Rec)");
+  returnZone.setPl(1);
+  model.addZone(returnZone);
+  openstudio::contam::Zone supplyZone(0, 0.0, 293.15, "AHS(Sup)");
+  supplyZone.setPl(1);
+  model.addZone(supplyZone);
+  double a = 100.0;
+  openstudio::contam::QfrQab leak(0, 0, "linear", "Linear volume flow leak", a, 0.0);
+  model.addAirflowElement(leak);
+  model.addAhs(openstudio::contam::Ahs(0, 2, 3, 4, 5, 6, "AHS", "Simple air handling system"));
+
+  openstudio::contam::AirflowPath exterior(0, 1, 1, 0, 1, 0.0, 1.0, 0.0, 0.0, 0.0, 0);
+  model.addAirflowPath(exterior);
+  openstudio::contam::AirflowPath supply(openstudio::contam::AHS_S, 3, 1, 0, 1, 0.0, 1.0, 0);
+  supply.setPa(1);
+  supply.setFahs(0.02);
+  model.addAirflowPath(supply);
+  openstudio::contam::AirflowPath ret(openstudio::contam::AHS_S, 1, 2, 0, 1, 0.0, 1.0, 0);
+  ret.setPa(1);
+  ret.setFahs(0.015);
+  model.addAirflowPath(ret);
+  model.addAirflowPath(openstudio::contam::AirflowPath(openstudio::contam::AHS_R, 2, 3, 0, 1, 0.0, 1.0, 0));
+  model.addAirflowPath(openstudio::contam::AirflowPath(openstudio::contam::AHS_O, -1, 3, 0, 1, 0.0, 1.0, 0));
+  model.addAirflowPath(openstudio::contam::AirflowPath(openstudio::contam::AHS_X, 2, -1, 0, 1, 0.0, 1.0, 0));
+
+  openstudio::contam::AirflowSolver solver(model);
+  ASSERT_TRUE(solver.valid());
+  openstudio::contam::WeatherData weather(293.15, 101325.0, 0.0, 0.0, 0.0, 1, 0, 0, 0, 0);
+  ASSERT_TRUE(solver.solve(weather));
+
+  // All of the return air is recirculated and outdoor air makes up the rest of the supply
+  double rho = 101325.0/(287.055*293.15);
+  double P = a*0.005/rho;
+  std::vector<double> flows = solver.pathFlows();
+  ASSERT_EQ(6u, flows.size());
+  EXPECT_NEAR(0.005, flows[0], 1.0e-6);
+  EXPECT_NEAR(0.02, flows[1], 1.0e-12);
+  EXPECT_NEAR(0.015, flows[2], 1.0e-12);
+  EXPECT_NEAR(0.015, flows[3], 1.0e-12);
+  EXPECT_NEAR(0.005, flows[4], 1.0e-12);
+  EXPECT_NEAR(0.0, flows[5], 1.0e-12);
+  ASSERT_EQ(3u, solver.zonePressures().size());
+  EXPECT_NEAR(P, solver.zonePressures()[0], 1.0e-3*P);
+}
@@ -0,0 +1,847 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "AirflowSolver.hpp"
+
+#include "../utilities/core/Logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace openstudio {
+namespace contam {
+
+namespace detail {
+
+  static const double GRAVITY = 9.80665;    // gravitational acceleration [m/s^2]
+  static const double RGAS = 287.055;       // gas constant of dry air [J/kg K]
+  static const double DPMIN = 1.0e-10;      // smallest pressure difference used in derivatives [Pa]
+
+  // Viscosity of air [kg/m s] as a function of temperature [K]
+  static double viscosity(double T)
+  {
+    return 1.71432e-5 + 4.828e-8*(T - 273.15);
+  }
+
+  /** Flow relationship of a single path, reduced from its airflow element. */
+  struct PathModel
+  {
+    enum Type {Closed, PowerLaw, Quadratic, ConstantMass, ConstantVolume, Fan, AhsSupplyReturn, AhsInternal};
+
+    PathModel() : type(Closed), n(-1), m(-1), height(0.0), mult(1.0), lam(0.0), turb(0.0), expt(0.5),
+      rhoPower(0.5), turbNeg(0.0), exptNeg(0.5), a(0.0), b(0.0), flow(0.0), rdens(1.2041), fdf(0.0),
+      sop(0.0), wind(false), pw(0), wPset(0.0), wPmod(0.0), wazm(0.0), sn(0.0), sm(0.0)
+    {}
+
+    Type type;
+    int n;              // zone index of the N side, -1 for ambient
+    int m;              // zone index of the M side, -1 for ambient
+    double height;      // path elevation [m]
+    double mult;        // element multiplier
+    // Power law: F = turb * rho^rhoPower * dP^expt, limited by F = lam * rho / mu * dP
+    double lam;
+    double turb;
+    double expt;
+    double rhoPower;
+    double turbNeg;     // back draft dampers use a second set of coefficients for negative flow
+    double exptNeg;
+    // Quadratic: dP = a * X + b * X^2, where X is mass flow, or volume flow if rhoPower == 1
+    double a;
+    double b;
+    // Constant mass or volume flow
+    double flow;
+    // Fan performance curve: pressure rise = sum of fpc[i] * F^i at the reference density
+    double rdens;
+    double fdf;
+    double sop;
+    std::vector<double> fpc;
+    // Wind pressure
+    bool wind;
+    int pw;
+    double wPset;
+    double wPmod;
+    double wazm;
+    // Stack and wind pressure terms for the current conditions, dP = (Pn + sn) - (Pm + sm)
+    double sn;
+    double sm;
+  };
+
+  class AirflowSolverImpl
+  {
+  public:
+    explicit AirflowSolverImpl(const IndexModel &model);
+
+    bool valid() const { return m_valid; }
+    bool solve(const WeatherData &weather);
+    int iterations() const { return m_iterations; }
+    std::vector<double> pathFlows() const { return m_flows; }
+    std::vector<double> pathDeltaPs() const { return m_dP; }
+    std::vector<double> zonePressures() const { return m_P; }
+
+    bool run(const std::vector<openstudio::DateTime> &dateTimes, const std::vector<WeatherData> &weather);
+    boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
+    boost::optional<openstudio::TimeSeries> pathFlow(int nr) const;
+    boost::optional<openstudio::TimeSeries> nodePressure(int nr) const;
+    std::vector<openstudio::DateTime> dateTimes() const { return m_dateTimes; }
+
+  private:
+    void setConditions(const WeatherData &weather);
+    // Computes the path flows and zone residuals at pressures P, and if jacobian is true the
+    // network matrix. With linear true, power law elements are replaced by linear resistances.
+    double evaluate(const std::vector<double> &P, bool jacobian, bool linear);
+    void pathFlow(const PathModel &path, double dP, bool linear, double &F, double &dFdP) const;
+    double powerLaw(double lam, double turb, double expt, double rhoPower, double rho, double mu,
+      double dP, bool linear, double &dFdP) const;
+    bool converged() const;
+    bool solveLinear(std::vector<double> &x);
+    void balanceAhs();
+    double windPressure(const PathModel &path, double rhoAmb, double windSpeed, double windDirection) const;
+
+    bool m_valid;
+    int m_iterations;
+
+    std::vector<PathModel> m_paths;
+    std::vector<Ahs> m_ahs;
+    std::vector<WindPressureProfile> m_profiles;
+    std::vector<double> m_zoneHeight;
+    std::vector<double> m_zoneT;
+    std::vector<double> m_zoneP0;
+    std::vector<int> m_unknown;        // zone index -> unknown index, -1 for fixed pressure zones
+
+    // run control
+    int m_maxIterations;
+    double m_relativeConvergence;
+    double m_absoluteConvergence;
+    int m_maxLinearIterations;
+    double m_linearConvergence;
+    bool m_linearInitialization;
+
+    // current conditions
+    double m_Tamb;
+    double m_rhoAmb;
+    std::vector<double> m_zoneRho;
+
+    // sparse (compressed row) network matrix for the unknown zone pressures
+    std::vector<int> m_rowStart;
+    std::vector<int> m_columns;
+    std::vector<double> m_values;
+    std::vector<int> m_diagonal;                   // index of each row's diagonal entry
+    std::vector<std::pair<int,int> > m_offDiagonal; // per path, the (n,m) and (m,n) entries
+    std::vector<double> m_residual;
+    std::vector<double> m_flowSum;
+
+    // solution
+    bool m_solved;
+    std::vector<double> m_P;
+    std::vector<double> m_flows;
+    std::vector<double> m_dP;
+
+    // time series results
+    std::vector<openstudio::DateTime> m_dateTimes;
+    std::vector<std::vector<double> > m_flowResults;
+    std::vector<std::vector<double> > m_dPResults;
+    std::vector<std::vector<double> > m_PResults;
+
+    REGISTER_LOGGER("openstudio.contam.AirflowSolver");
+  };
+
+  AirflowSolverImpl::AirflowSolverImpl(const IndexModel &model)
+    : m_valid(true), m_iterations(0), m_Tamb(293.15), m_rhoAmb(1.2041), m_solved(false)
+  {
+    RunControl rc = model.rc();
+    m_maxIterations = rc.afmaxi() > 0 ? rc.afmaxi() : 100;
+    m_relativeConvergence = rc.afrcnvg() > 0 ? rc.afrcnvg() : 1.0e-4;
+    m_absoluteConvergence = rc.afacnvg() > 0 ? rc.afacnvg() : 1.0e-5;
+    m_maxLinearIterations = rc.aflmaxi() > 0 ? rc.aflmaxi() : 1000;
+    m_linearConvergence = rc.aflcnvg() > 0 ? rc.aflcnvg() : 1.0e-10;
+    m_linearInitialization = rc.aflinit() != 0;
+
+    m_ahs = model.ahs();
+    m_profiles = model.windPressureProfiles();
+
+    std::vector<Level> levels = model.levels();
+    std::vector<Zone> zones = model.zones();
+    std::vector<AirflowPath> paths = model.airflowPaths();
+
+    int nUnknowns = 0;
+    for(Zone zone : zones) {
+      double height = 0.0;
+      if(zone.pl() > 0 && (unsigned)zone.pl() <= levels.size()) {
+        height = levels[zone.pl()-1].refht();
+      }
+      m_zoneHeight.push_back(height);
+      m_zoneT.push_back(zone.T0());
+      m_zoneP0.push_back(zone.P0());
+      if(zone.variablePressure()) {
+        m_unknown.push_back(nUnknowns++);
+      } else {
+        m_unknown.push_back(-1);
+      }
+    }
+
+    for(AirflowPath path : paths) {
+      PathModel pm;
+      pm.n = (path.pzn() > 0 && (unsigned)path.pzn() <= zones.size()) ? path.pzn()-1 : -1;
+      pm.m = (path.pzm() > 0 && (unsigned)path.pzm() <= zones.size()) ? path.pzm()-1 : -1;
+      pm.height = path.relHt();
+      if(path.pld() > 0 && (unsigned)path.pld() <= levels.size()) {
+        pm.height += levels[path.pld()-1].refht();
+      }
+      pm.mult = path.mult() > 0 ? path.mult() : 1.0;
+      pm.wind = path.windPressure();
+      pm.pw = path.pw();
+      pm.wPset = path.wPset();
+      pm.wPmod = path.wPmod();
+      pm.wazm = path.wazm();
+
+      std::shared_ptr<AirflowElement> element = model.airflowElement(path.pe());
+      if(!element) {
+        if(path.system() && path.pa() > 0) {
+          pm.type = PathModel::AhsSupplyReturn;
+          pm.flow = path.Fahs();
+        } else if(path.recirculation() || path.outsideAir() || path.exhaust()) {
+          pm.type = PathModel::AhsInternal;
+        } else {
+          LOG(Warn, "Path " << path.nr() << " has no airflow element and will be treated as closed");
+        }
+        m_paths.push_back(pm);
+        continue;
+      }
+
+      std::string type = element->dataType();
+      if(PlrOrf *afe = dynamic_cast<PlrOrf*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrLeak *afe = dynamic_cast<PlrLeak*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrConn *afe = dynamic_cast<PlrConn*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrGeneral *afe = dynamic_cast<PlrGeneral*>(element.get())) {
+        // Volume flow (qcn) or mass flow (fcn) power law
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+        pm.rhoPower = (type == "plr_qcn") ? 1.0 : 0.0;
+      } else if(PlrTest1 *afe = dynamic_cast<PlrTest1*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrTest2 *afe = dynamic_cast<PlrTest2*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrCrack *afe = dynamic_cast<PlrCrack*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrStair *afe = dynamic_cast<PlrStair*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrShaft *afe = dynamic_cast<PlrShaft*>(element.get())) {
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+      } else if(PlrBackDamper *afe = dynamic_cast<PlrBackDamper*>(element.get())) {
+        // Volume flow (bdq) or mass flow (bdf) with separate positive and negative coefficients
+        pm.type = PathModel::PowerLaw; pm.lam = afe->lam(); pm.turb = afe->Cp(); pm.expt = afe->xp();
+        pm.turbNeg = afe->Cn(); pm.exptNeg = afe->xn();
+        pm.rhoPower = (type == "plr_bdq") ? 1.0 : 0.0;
+      } else if(QfrGeneral *afe = dynamic_cast<QfrGeneral*>(element.get())) {
+        pm.type = PathModel::Quadratic; pm.a = afe->a(); pm.b = afe->b();
+        pm.rhoPower = (type == "qfr_qab") ? 1.0 : 0.0;
+      } else if(QfrCrack *afe = dynamic_cast<QfrCrack*>(element.get())) {
+        pm.type = PathModel::Quadratic; pm.a = afe->a(); pm.b = afe->b(); pm.rhoPower = 0.0;
+      } else if(QfrTest2 *afe = dynamic_cast<QfrTest2*>(element.get())) {
+        pm.type = PathModel::Quadratic; pm.a = afe->a(); pm.b = afe->b(); pm.rhoPower = 0.0;
+      } else if(AfeFlow *afe = dynamic_cast<AfeFlow*>(element.get())) {
+        pm.type = (type == "fan_cvf") ? PathModel::ConstantVolume : PathModel::ConstantMass;
+        pm.flow = afe->Flow();
+      } else if(AfeFan *afe = dynamic_cast<AfeFan*>(element.get())) {
+        // The off-curve flow uses the shut-off orifice power law
+        pm.type = PathModel::Fan; pm.lam = afe->lam(); pm.turb = afe->turb(); pm.expt = afe->expt();
+        pm.rdens = afe->rdens() > 0 ? afe->rdens() : 1.2041;
+        pm.fdf = afe->fdf(); pm.sop = afe->sop(); pm.fpc = afe->fpc();
+      } else {
+        LOG(Error, "Path " << path.nr() << " uses a '" << type << "' airflow element, which is not supported");
+        m_valid = false;
+      }
+      m_paths.push_back(pm);
+    }
+
+    // Build the sparsity pattern of the network matrix
+    std::vector<std::vector<int> > columns(nUnknowns);
+    for(int i=0;i<nUnknowns;i++) {
+      columns[i].push_back(i);
+    }
+    for(const PathModel &pm : m_paths) {
+      if(pm.n >= 0 && pm.m >= 0 && m_unknown[pm.n] >= 0 && m_unknown[pm.m] >= 0 && pm.n != pm.m) {
+        columns[m_unknown[pm.n]].push_back(m_unknown[pm.m]);
+        columns[m_unknown[pm.m]].push_back(m_unknown[pm.n]);
+      }
+    }
+    m_rowStart.push_back(0);
+    for(std::vector<int> &row : columns) {
+      std::sort(row.begin(), row.end());
+      row.erase(std::unique(row.begin(), row.end()), row.end());
+      m_columns.insert(m_columns.end(), row.begin(), row.end());
+      m_rowStart.push_back(m_columns.size());
+    }
+    auto entry = [this](int row, int col) {
+      auto begin = m_columns.begin() + m_rowStart[row];
+      auto end = m_columns.begin() + m_rowStart[row+1];
+      return (int)(std::lower_bound(begin, end, col) - m_columns.begin());
+    };
+    for(int i=0;i<nUnknowns;i++) {
+      m_diagonal.push_back(entry(i,i));
+    }
+    for(const PathModel &pm : m_paths) {
+      if(pm.n >= 0 && pm.m >= 0 && m_unknown[pm.n] >= 0 && m_unknown[pm.m] >= 0 && pm.n != pm.m) {
+        m_offDiagonal.push_back(std::make_pair(entry(m_unknown[pm.n], m_unknown[pm.m]),
+          entry(m_unknown[pm.m], m_unknown[pm.n])));
+      } else {
+        m_offDiagonal.push_back(std::make_pair(-1, -1));
+      }
+    }
+    m_values.resize(m_columns.size());
+    m_residual.resize(nUnknowns);
+    m_flowSum.resize(nUnknowns);
+
+    m_P = m_zoneP0;
+    m_flows.resize(m_paths.size());
+    m_dP.resize(m_paths.size());
+    m_flowResults.resize(m_paths.size());
+    m_dPResults.resize(m_paths.size());
+    m_PResults.resize(zones.size());
+  }
+
+  double AirflowSolverImpl::windPressure(const PathModel &path, double rhoAmb, double windSpeed,
+    double windDirection) const
+  {
+    if(!path.wind) {
+      return 0.0;
+    }
+    if(path.pw <= 0 || (unsigned)path.pw > m_profiles.size()) {
+      return path.wPset;
+    }
+    // Linear interpolation of the pressure coefficient in the wind angle relative to the wall
+    std::vector<PressureCoefficientPoint> points = m_profiles[path.pw-1].coeffs();
+    if(points.empty()) {
+      return 0.0;
+    }
+    double angle = std::fmod(windDirection - path.wazm, 360.0);
+    if(angle < 0) {
+      angle += 360.0;
+    }
+    double Cp = points.back().coef();
+    double azm0 = points.back().azm() - 360.0;
+    double Cp0 = points.back().coef();
+    for(PressureCoefficientPoint point : points) {
+      if(angle <= point.azm()) {
+        double span = point.azm() - azm0;
+        Cp = span > 0 ? Cp0 + (point.coef() - Cp0)*(angle - azm0)/span : point.coef();
+        break;
+      }
+      azm0 = point.azm();
+      Cp0 = point.coef();
+    }
+    double V = path.wPmod*windSpeed;
+    return 0.5*rhoAmb*V*V*Cp;
+  }
+
+  void AirflowSolverImpl::setConditions(const WeatherData &weather)
+  {
+    double Pbar = weather.barpres() > 0 ? weather.barpres() : 101325.0;
+    m_Tamb = weather.Tambt();
+    m_rhoAmb = Pbar/(RGAS*m_Tamb);
+    m_zoneRho.clear();
+    for(double T : m_zoneT) {
+      m_zoneRho.push_back(Pbar/(RGAS*T));
+    }
+    // Hydrostatic pressure differences from the zone nodes (or ground level outside) to the path
+    for(PathModel &path : m_paths) {
+      double ambient = -m_rhoAmb*GRAVITY*path.height;
+      if(path.n >= 0) {
+        path.sn = -m_zoneRho[path.n]*GRAVITY*(path.height - m_zoneHeight[path.n]);
+      } else {
+        path.sn = ambient + windPressure(path, m_rhoAmb, weather.windspd(), weather.winddir());
+      }
+      if(path.m >= 0) {
+        path.sm = -m_zoneRho[path.m]*GRAVITY*(path.height - m_zoneHeight[path.m]);
+      } else {
+        path.sm = ambient + windPressure(path, m_rhoAmb, weather.windspd(), weather.winddir());
+      }
+    }
+  }
+
+  double AirflowSolverImpl::powerLaw(double lam, double turb, double expt, double rhoPower, double rho,
+    double mu, double dP, bool linear, double &dFdP) const
+  {
+    double C = turb*std::pow(rho, rhoPower);
+    double adP = std::fabs(dP);
+    double sign = dP < 0 ? -1.0 : 1.0;
+    if(linear) {
+      dFdP = C;
+      return C*dP;
+    }
+    // Use the laminar relationship where it gives the smaller flow
+    double FT = C*std::pow(adP, expt);
+    double CL = lam*rho/mu;
+    if(CL > 0 && CL*adP <= FT) {
+      dFdP = CL;
+      return CL*dP;
+    }
+    dFdP = expt*C*std::pow(std::max(adP, DPMIN), expt - 1.0);
+    return sign*FT;
+  }
+
+  void AirflowSolverImpl::pathFlow(const PathModel &path, double dP, bool linear, double &F, double &dFdP) const
+  {
+    // Properties of the upstream air
+    int up = dP >= 0 ? path.n : path.m;
+    double rho = up >= 0 ? m_zoneRho[up] : m_rhoAmb;
+    double mu = viscosity(up >= 0 ? m_zoneT[up] : m_Tamb);
+    F = 0.0;
+    dFdP = 0.0;
+    switch(path.type) {
+    case PathModel::PowerLaw:
+      if(dP < 0 && path.turbNeg > 0) {
+        F = powerLaw(path.lam, path.turbNeg, path.exptNeg, path.rhoPower, rho, mu, dP, linear, dFdP);
+      } else {
+        F = powerLaw(path.lam, path.turb, path.expt, path.rhoPower, rho, mu, dP, linear, dFdP);
+      }
+      break;
+    case PathModel::Quadratic:
+      {
+        double scale = path.rhoPower > 0 ? rho : 1.0;
+        double adP = std::fabs(dP);
+        double X;
+        if(path.b > 0) {
+          X = (-path.a + std::sqrt(path.a*path.a + 4.0*path.b*adP))/(2.0*path.b);
+        } else if(path.a > 0) {
+          X = adP/path.a;
+        } else {
+          break;
+        }
+        F = (dP < 0 ? -1.0 : 1.0)*scale*X;
+        dFdP = scale/(path.a + 2.0*path.b*X);
+      }
+      break;
+    case PathModel::ConstantMass:
+    case PathModel::AhsSupplyReturn:
+      F = path.flow;
+      break;
+    case PathModel::ConstantVolume:
+      {
+        int source = path.flow >= 0 ? path.n : path.m;
+        F = path.flow*(source >= 0 ? m_zoneRho[source] : m_rhoAmb);
+      }
+      break;
+    case PathModel::Fan:
+      {
+        // Fans move air from N to M against the pressure rise
+        int source = path.n;
+        double rhoFan = source >= 0 ? m_zoneRho[source] : m_rhoAmb;
+        double ratio = rhoFan/path.rdens;
+        double rise = -dP/ratio;
+        auto curve = [&path](double flow, double &slope) {
+          double value = 0.0;
+          slope = 0.0;
+          if(path.fpc.empty() || std::all_of(path.fpc.begin(), path.fpc.end(), [](double c){return c == 0.0;})) {
+            // Straight line from shut-off to free delivery
+            slope = path.fdf > 0 ? -path.sop/path.fdf : 0.0;
+            return path.sop + slope*flow;
+          }
+          double power = 1.0;
+          for(unsigned i=0;i<path.fpc.size();i++) {
+            value += path.fpc[i]*power;
+            if(i+1 < path.fpc.size()) {
+              slope += (i+1)*path.fpc[i+1]*power;
+            }
+            power *= flow;
+          }
+          return value;
+        };
+        double slope;
+        if(rise > path.sop) {
+          // Reverse flow through the stopped fan
+          double dFdRise;
+          F = -powerLaw(path.lam, path.turb, path.expt, 0.5, rhoFan, viscosity(m_Tamb), rise - path.sop, linear, dFdRise);
+          dFdP = dFdRise/ratio;
+        } else if(rise < 0) {
+          // Beyond free delivery, extend the curve linearly
+          curve(path.fdf, slope);
+          if(slope >= 0) {
+            slope = -1.0;
+          }
+          F = ratio*(path.fdf + rise/slope);
+          dFdP = -1.0/slope;
+        } else {
+          // Bisect the curve between shut-off and free delivery
+          double lo = 0.0, hi = path.fdf;
+          for(int i=0;i<60;i++) {
+            double mid = 0.5*(lo + hi);
+            if(curve(mid, slope) > rise) {
+              lo = mid;
+            } else {
+              hi = mid;
+            }
+          }
+          double flow = 0.5*(lo + hi);
+          curve(flow, slope);
+          F = ratio*flow;
+          dFdP = slope < 0 ? -1.0/slope : path.fdf/std::max(path.sop, DPMIN);
+        }
+      }
+      break;
+    default:
+      break;
+    }
+    F *= path.mult;
+    dFdP *= path.mult;
+  }
+
+  double AirflowSolverImpl::evaluate(const std::vector<double> &P, bool jacobian, bool linear)
+  {
+    std::fill(m_residual.begin(), m_residual.end(), 0.0);
+    std::fill(m_flowSum.begin(), m_flowSum.end(), 0.0);
+    if(jacobian) {
+      std::fill(m_values.begin(), m_values.end(), 0.0);
+    }
+    for(unsigned i=0;i<m_paths.size();i++) {
+      const PathModel &path = m_paths[i];
+      if(path.type == PathModel::Closed || path.type == PathModel::AhsInternal) {
+        m_flows[i] = 0.0;
+        m_dP[i] = 0.0;
+        continue;
+      }
+      double Pn = path.n >= 0 ? P[path.n] : 0.0;
+      double Pm = path.m >= 0 ? P[path.m] : 0.0;
+      double dP = (Pn + path.sn) - (Pm + path.sm);
+      double F, dFdP;
+      pathFlow(path, dP, linear, F, dFdP);
+      m_flows[i] = F;
+      m_dP[i] = dP;
+      int un = path.n >= 0 ? m_unknown[path.n] : -1;
+      int um = path.m >= 0 ? m_unknown[path.m] : -1;
+      if(un >= 0) {
+        m_residual[un] -= F;
+        m_flowSum[un] += std::fabs(F);
+      }
+      if(um >= 0) {
+        m_residual[um] += F;
+        m_flowSum[um] += std::fabs(F);
+      }
+      if(jacobian && un != um) {
+        if(un >= 0) {
+          m_values[m_diagonal[un]] += dFdP;
+        }
+        if(um >= 0) {
+          m_values[m_diagonal[um]] += dFdP;
+        }
+        if(m_offDiagonal[i].first >= 0) {
+          m_values[m_offDiagonal[i].first] -= dFdP;
+          m_values[m_offDiagonal[i].second] -= dFdP;
+        }
+      }
+    }
+    double norm = 0.0;
+    for(double r : m_residual) {
+      norm += r*r;
+    }
+    return norm;
+  }
+
+  bool AirflowSolverImpl::converged() const
+  {
+    for(unsigned i=0;i<m_residual.size();i++) {
+      double r = std::fabs(m_residual[i]);
+      if(r > m_absoluteConvergence && r > m_relativeConvergence*m_flowSum[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool AirflowSolverImpl::solveLinear(std::vector<double> &x)
+  {
+    // Jacobi preconditioned conjugate gradient solution of the network matrix with m_residual
+    unsigned n = m_residual.size();
+    std::vector<double> invDiag(n);
+    for(unsigned i=0;i<n;i++) {
+      double d = m_values[m_diagonal[i]];
+      if(d <= 0) {
+        LOG(Error, "Variable pressure zone with unknown index " << i << " is not connected to a fixed pressure");
+        return false;
+      }
+      invDiag[i] = 1.0/d;
+    }
+    x.assign(n, 0.0);
+    std::vector<double> r = m_residual;
+    std::vector<double> z(n), p(n), q(n);
+    double rz = 0.0, bnorm = 0.0;
+    for(unsigned i=0;i<n;i++) {
+      z[i] = invDiag[i]*r[i];
+      p[i] = z[i];
+      rz += r[i]*z[i];
+      bnorm += r[i]*r[i];
+    }
+    if(bnorm == 0.0) {
+      return true;
+    }
+    double tol = m_linearConvergence*m_linearConvergence*bnorm;
+    for(int iter=0;iter<m_maxLinearIterations;iter++) {
+      double pq = 0.0;
+      for(unsigned i=0;i<n;i++) {
+        double sum = 0.0;
+        for(int k=m_rowStart[i];k<m_rowStart[i+1];k++) {
+          sum += m_values[k]*p[m_columns[k]];
+        }
+        q[i] = sum;
+        pq += p[i]*sum;
+      }
+      if(pq <= 0.0) {
+        break;
+      }
+      double alpha = rz/pq;
+      double rnorm = 0.0;
+      for(unsigned i=0;i<n;i++) {
+        x[i] += alpha*p[i];
+        r[i] -= alpha*q[i];
+        rnorm += r[i]*r[i];
+      }
+      if(rnorm <= tol) {
+        return true;
+      }
+      double rzNew = 0.0;
+      for(unsigned i=0;i<n;i++) {
+        z[i] = invDiag[i]*r[i];
+        rzNew += r[i]*z[i];
+      }
+      double beta = rzNew/rz;
+      rz = rzNew;
+      for(unsigned i=0;i<n;i++) {
+        p[i] = z[i] + beta*p[i];
+      }
+    }
+    // An inexact step is still usable by the outer iteration
+    return true;
+  }
+
+  void AirflowSolverImpl::balanceAhs()
+  {
+    // Outdoor air makes up the difference between the supply and the recirculated return air
+    for(Ahs ahs : m_ahs) {
+      double supply = 0.0;
+      double ret = 0.0;
+      for(unsigned i=0;i<m_paths.size();i++) {
+        if(m_paths[i].type != PathModel::AhsSupplyReturn) {
+          continue;
+        }
+        if(m_paths[i].n == ahs.zone_s()-1) {
+          supply += m_flows[i];
+        } else if(m_paths[i].m == ahs.zone_r()-1) {
+          ret += m_flows[i];
+        }
+      }
+      double recirc = std::max(0.0, std::min(supply, ret));
+      std::vector<std::pair<int,double> > flows = {{ahs.path_r(), recirc}, {ahs.path_s(), supply - recirc},
+        {ahs.path_x(), ret - recirc}};
+      for(const std::pair<int,double> &flow : flows) {
+        if(flow.first > 0 && (unsigned)flow.first <= m_paths.size()) {
+          m_flows[flow.first-1] = flow.second;
+        }
+      }
+    }
+  }
+
+  bool AirflowSolverImpl::solve(const WeatherData &weather)
+  {
+    m_iterations = 0;
+    if(!m_valid) {
+      LOG(Error, "Model contains airflow elements that are not supported, no solution computed");
+      return false;
+    }
+    setConditions(weather);
+
+    unsigned nZones = m_P.size();
+    std::vector<double> dx;
+    if(!m_solved && m_linearInitialization && !m_residual.empty()) {
+      // One step of the linearized network from the initial pressures
+      evaluate(m_P, true, true);
+      if(solveLinear(dx)) {
+        for(unsigned i=0;i<nZones;i++) {
+          if(m_unknown[i] >= 0) {
+            m_P[i] += dx[m_unknown[i]];
+          }
+        }
+      }
+    }
+
+    double norm = evaluate(m_P, true, false);
+    std::vector<double> trial(m_P);
+    bool done = converged();
+    while(!done && m_iterations < m_maxIterations) {
+      ++m_iterations;
+      if(!solveLinear(dx)) {
+        break;
+      }
+      // Newton step with backtracking until the residual drops
+      double relax = 1.0;
+      double trialNorm = 0.0;
+      for(int halving=0;halving<10;halving++) {
+        for(unsigned i=0;i<nZones;i++) {
+          if(m_unknown[i] >= 0) {
+            trial[i] = m_P[i] + relax*dx[m_unknown[i]];
+          }
+        }
+        trialNorm = evaluate(trial, false, false);
+        if(trialNorm < norm) {
+          break;
+        }
+        relax *= 0.5;
+      }
+      m_P = trial;
+      norm = evaluate(m_P, true, false);
+      done = converged();
+    }
+
+    balanceAhs();
+    m_solved = true;
+    if(!done) {
+      LOG(Warn, "Airflow solution did not converge in " << m_iterations << " iterations");
+    }
+    return done;
+  }
+
+  bool AirflowSolverImpl::run(const std::vector<openstudio::DateTime> &dateTimes,
+    const std::vector<WeatherData> &weather)
+  {
+    if(dateTimes.size() != weather.size()) {
+      LOG(Error, "Number of date and times does not match the number of weather conditions");
+      return false;
+    }
+    m_dateTimes = dateTimes;
+    for(std::vector<double> &v : m_flowResults) {
+      v.clear();
+    }
+    for(std::vector<double> &v : m_dPResults) {
+      v.clear();
+    }
+    for(std::vector<double> &v : m_PResults) {
+      v.clear();
+    }
+    bool success = true;
+    for(const WeatherData &conditions : weather) {
+      success = solve(conditions) && success;
+      for(unsigned i=0;i<m_paths.size();i++) {
+        m_flowResults[i].push_back(m_flows[i]);
+        m_dPResults[i].push_back(m_dP[i]);
+      }
+      for(unsigned i=0;i<m_P.size();i++) {
+        m_PResults[i].push_back(m_P[i]);
+      }
+    }
+    return success;
+  }
+
+  boost::optional<openstudio::TimeSeries> AirflowSolverImpl::pathDeltaP(int nr) const
+  {
+    if(m_dateTimes.empty() || nr <= 0 || (unsigned)nr > m_dPResults.size()) {
+      return boost::optional<openstudio::TimeSeries>();
+    }
+    return openstudio::TimeSeries(m_dateTimes, createVector(m_dPResults[nr-1]), "Pa");
+  }
+
+  boost::optional<openstudio::TimeSeries> AirflowSolverImpl::pathFlow(int nr) const
+  {
+    if(m_dateTimes.empty() || nr <= 0 || (unsigned)nr > m_flowResults.size()) {
+      return boost::optional<openstudio::TimeSeries>();
+    }
+    return openstudio::TimeSeries(m_dateTimes, createVector(m_flowResults[nr-1]), "kg/s");
+  }
+
+  boost::optional<openstudio::TimeSeries> AirflowSolverImpl::nodePressure(int nr) const
+  {
+    if(m_dateTimes.empty() || nr <= 0 || (unsigned)nr > m_PResults.size()) {
+      return boost::optional<openstudio::TimeSeries>();
+    }
+    return openstudio::TimeSeries(m_dateTimes, createVector(m_PResults[nr-1]), "Pa");
+  }
+
+} // detail
+
+AirflowSolver::AirflowSolver(const IndexModel &model) :
+  m_impl(std::shared_ptr<detail::AirflowSolverImpl>(new detail::AirflowSolverImpl(model)))
+{}
+
+bool AirflowSolver::valid() const
+{
+  return m_impl->valid();
+}
+
+bool AirflowSolver::solve(const WeatherData &weather)
+{
+  return m_impl->solve(weather);
+}
+
+int AirflowSolver::iterations() const
+{
+  return m_impl->iterations();
+}
+
+std::vector<double> AirflowSolver::pathFlows() const
+{
+  return m_impl->pathFlows();
+}
+
+std::vector<double> AirflowSolver::pathDeltaPs() const
+{
+  return m_impl->pathDeltaPs();
+}
+
+std::vector<double> AirflowSolver::zonePressures() const
+{
+  return m_impl->zonePressures();
+}
+
+bool AirflowSolver::run(const std::vector<openstudio::DateTime> &dateTimes, const std::vector<WeatherData> &weather)
+{
+  return m_impl->run(dateTimes, weather);
+}
+
+boost::optional<openstudio::TimeSeries> AirflowSolver::pathDeltaP(int nr) const
+{
+  return m_impl->pathDeltaP(nr);
+}
+
+boost::optional<openstudio::TimeSeries> AirflowSolver::pathFlow(int nr) const
+{
+  return m_impl->pathFlow(nr);
+}
+
+boost::optional<openstudio::TimeSeries> AirflowSolver::nodePressure(int nr) const
+{
+  return m_impl->nodePressure(nr);
+}
+
+std::vector<openstudio::DateTime> AirflowSolver::dateTimes() const
+{
+  return m_impl->dateTimes();
+}
+
+} // contam
+} // openstudio
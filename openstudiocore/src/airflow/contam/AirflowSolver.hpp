@@ -0,0 +1,114 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
+#define AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
+
+#include "PrjModel.hpp"
+
+#include "../utilities/data/TimeSeries.hpp"
+
+#include "../AirflowAPI.hpp"
+
+namespace openstudio {
+namespace contam {
+
+namespace detail {
+  class AirflowSolverImpl;
+}
+
+/** AirflowSolver computes steady-state airflows in an IndexModel without running ContamX.
+*
+*  The pressures of the variable pressure zones are found by Newton-Raphson iteration on the zone
+*  mass balances. Each iteration solves the sparse, symmetric Jacobian of the network with a Jacobi
+*  preconditioned conjugate gradient method. The iteration limits and convergence criteria are
+*  taken from the model's RunControl object. Zone temperatures are the initial zone temperatures,
+*  and the ambient conditions are given by a WeatherData object.
+*
+*  Power law elements (PlrOrf, PlrLeak1-3, PlrConn, PlrQcn, PlrFcn, PlrTest1, PlrTest2, PlrCrack,
+*  PlrStair, PlrShaft, PlrBdq and PlrBdf), quadratic elements (QfrQab, QfrFab, QfrCrack and
+*  QfrTest2), constant flow fans (AfeCmf and AfeCvf), performance curve fans (AfeFan) and simple
+*  air handling system paths are supported. Models with paths that use other elements are not
+*  valid for this solver.
+*
+*/
+class AIRFLOW_API AirflowSolver
+{
+public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  /** Creates a solver for the model. The model is not referenced after construction. */
+  explicit AirflowSolver(const IndexModel &model);
+
+  //@}
+  /** @name Steady-State Solution */
+  //@{
+
+  /** Returns false if the model contains paths the solver cannot handle. */
+  bool valid() const;
+  /** Computes the steady-state airflows for the weather conditions. The previous solution, if
+  *  any, is used as the starting point. Returns false if the solution did not converge. */
+  bool solve(const WeatherData &weather);
+  /** Returns the number of Newton-Raphson iterations used by the last solution. */
+  int iterations() const;
+  /** Returns the path mass flows [kg/s] of the last solution, indexed by path number - 1.
+  *  Positive flow is from zone N to zone M. */
+  std::vector<double> pathFlows() const;
+  /** Returns the path pressure differences [Pa] of the last solution, indexed by path number - 1. */
+  std::vector<double> pathDeltaPs() const;
+  /** Returns the zone pressures [Pa] of the last solution, indexed by zone number - 1. */
+  std::vector<double> zonePressures() const;
+
+  //@}
+  /** @name Time Series Solution */
+  //@{
+
+  /** Computes a steady-state solution for each set of weather conditions and stores the results
+  *  for the matching date and time. Returns false if any solution did not converge. */
+  bool run(const std::vector<openstudio::DateTime> &dateTimes, const std::vector<WeatherData> &weather);
+  /** Returns the path pressure differences computed by run. */
+  boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
+  /** Returns the path flows computed by run. */
+  boost::optional<openstudio::TimeSeries> pathFlow(int nr) const;
+  /** Returns the zone pressures computed by run. */
+  boost::optional<openstudio::TimeSeries> nodePressure(int nr) const;
+  /** Returns the date and times of the results computed by run. */
+  std::vector<openstudio::DateTime> dateTimes() const;
+
+  //@}
+
+private:
+  std::shared_ptr<detail::AirflowSolverImpl> m_impl;
+};
+
+} // contam
+} // openstudio
+
+#endif // AIRFLOW_CONTAM_AIRFLOWSOLVER_HPP
@@ -791,6 +791,31 @@ bool IndexModel::addAirflowElement(PlrLeak2 element)
   return m_impl->addAirflowElement(element);
 }
 
+bool IndexModel::addAirflowElement(PlrOrf element)
+{
+  return m_impl->addAirflowElement(element);
+}
+
+bool IndexModel::addAirflowElement(AfeCmf element)
+{
+  return m_impl->addAirflowElement(element);
+}
+
+bool IndexModel::addAirflowElement(AfeFan element)
+{
+  return m_impl->addAirflowElement(element);
+}
+
+bool IndexModel::addAirflowElement(QfrQab element)
+{
+  return m_impl->addAirflowElement(element);
+}
+
+std::shared_ptr<AirflowElement> IndexModel::airflowElement(int nr) const
+{
+  return m_impl->airflowElement(nr);
+}
+
 int IndexModel::airflowElementNrByName(std::string name) const
 {
   return m_impl->airflowElementNrByName(name);
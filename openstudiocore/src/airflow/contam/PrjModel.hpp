@@ -380,6 +380,16 @@ public:
   bool addAirflowElement(PlrTest1 element);
   /** Add a PlrLeak2 airflow element to the model. */
   bool addAirflowElement(PlrLeak2 element);
+  /** Add a PlrOrf airflow element to the model. */
+  bool addAirflowElement(PlrOrf element);
+  /** Add an AfeCmf airflow element to the model. */
+  bool addAirflowElement(AfeCmf element);
+  /** Add an AfeFan airflow element to the model. */
+  bool addAirflowElement(AfeFan element);
+  /** Add a QfrQab airflow element to the model. */
+  bool addAirflowElement(QfrQab element);
+  /** Returns the airflow element with element number nr, or a null pointer if there is no such element. */
+  std::shared_ptr<AirflowElement> airflowElement(int nr) const;
   /** Return the element number of the named airflow element */
   int airflowElementNrByName(std::string name) const;
   /** Replace an airflow element with a PlrTest1 airflow element */
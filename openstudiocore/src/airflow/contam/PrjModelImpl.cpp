@@ -1273,6 +1273,14 @@ int IndexModelImpl::airflowElementNrByName(std::string name) const
   return 0;
 }
 
+std::shared_ptr<AirflowElement> IndexModelImpl::airflowElement(int nr) const
+{
+  if(nr > 0 && (unsigned)nr <= m_airflowElements.size()) {
+    return m_airflowElements[nr-1];
+  }
+  return std::shared_ptr<AirflowElement>();
+}
+
 std::vector<std::vector<int> > IndexModelImpl::zoneExteriorFlowPaths()
 {
   std::vector<std::vector<int> > paths(m_zones.size());
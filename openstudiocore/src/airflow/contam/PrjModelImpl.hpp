@@ -343,6 +343,7 @@ public:
   }
 
   int airflowElementNrByName(std::string name) const;
+  std::shared_ptr<AirflowElement> airflowElement(int nr) const;
 
   template <class T> bool replaceAirflowElement(int nr, T element)
   {
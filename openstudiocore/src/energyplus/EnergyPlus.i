@@ -46,6 +46,9 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// Use the path overload
+%ignore openstudio::energyplus::ForwardTranslator::translateModelToIdf(const model::Model&, std::ostream&, ProgressBar*);
+
 %include <energyplus/ErrorFile.hpp>
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
@@ -29,19 +29,211 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
+#include "../utilities/core/Filesystem.hpp"
+
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // same characters as \s in the regular expressions this parser replaces
+    inline bool isSpace(char c)
+    {
+      return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    inline const char* skipSpaces(const char* it, const char* end)
+    {
+      while (it != end && isSpace(*it)){
+        ++it;
+      }
+      return it;
+    }
+
+    inline const char* skipStars(const char* it, const char* end)
+    {
+      while (it != end && *it == '*'){
+        ++it;
+      }
+      return it;
+    }
+
+    inline bool startsWith(const char* it, const char* end, const char* text)
+    {
+      size_t n = std::strlen(text);
+      return (static_cast<size_t>(end - it) >= n) && (std::strncmp(it, text, n) == 0);
+    }
+
+    // find the "**" opening a message, equivalent to ^\s*\**\s+\*\*
+    // both ways the prefix can be split are returned, in the order a backtracking regex would try them
+    unsigned messageStarts(const char* begin, const char* end, const char* starts[2])
+    {
+      unsigned result = 0;
+      const char* i = skipSpaces(begin, end);
+      const char* j = skipStars(i, end);
+      const char* k = skipSpaces(j, end);
+      if (k != j && startsWith(k, end, "**")){
+        starts[result++] = k;
+      }
+      if (i != begin && j != i && startsWith(i, end, "**")){
+        starts[result++] = i;
+      }
+      return result;
+    }
+
+    // ^\s*\**\s+\*\*\s*([^\s\*]+)\s*\*\*(.*)$
+    bool matchWarningOrError(const char* begin, const char* end, std::string& type, std::string& text)
+    {
+      const char* starts[2];
+      unsigned n = messageStarts(begin, end, starts);
+      for (unsigned i = 0; i < n; ++i){
+        const char* it = skipSpaces(starts[i] + 2, end);
+        const char* typeBegin = it;
+        while (it != end && !isSpace(*it) && *it != '*'){
+          ++it;
+        }
+        const char* typeEnd = it;
+        if (typeBegin == typeEnd){
+          continue;
+        }
+        it = skipSpaces(it, end);
+        if (!startsWith(it, end, "**")){
+          continue;
+        }
+        type.assign(typeBegin, typeEnd);
+        text.assign(it + 2, end);
+        return true;
+      }
+      return false;
+    }
+
+    // ^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$
+    bool matchWarningOrErrorContinue(const char* begin, const char* end, std::string& text)
+    {
+      const char* starts[2];
+      unsigned n = messageStarts(begin, end, starts);
+      for (unsigned i = 0; i < n; ++i){
+        const char* it = skipSpaces(starts[i] + 2, end);
+        if (!startsWith(it, end, "~~~")){
+          continue;
+        }
+        it = skipSpaces(it + 3, end);
+        if (!startsWith(it, end, "**")){
+          continue;
+        }
+        text.assign(it + 2, end);
+        return true;
+      }
+      return false;
+    }
+
+    // ^\s*\*+ followed by text, the rest of the line is ignored
+    bool matchCompletionLine(const char* begin, const char* end, const char* text)
+    {
+      const char* i = skipSpaces(begin, end);
+      const char* j = skipStars(i, end);
+      if (j == i || j == end || *j != ' '){
+        return false;
+      }
+      return startsWith(j + 1, end, text);
+    }
+
+    // ^\s*\*+ GroundTempCalc\S* Completed Successfully.*
+    bool matchGroundTempCompletedSuccessful(const char* begin, const char* end)
+    {
+      const char* i = skipSpaces(begin, end);
+      const char* j = skipStars(i, end);
+      if (j == i || j == end || *j != ' ' || !startsWith(j + 1, end, "GroundTempCalc")){
+        return false;
+      }
+      const char* it = j + 1 + std::strlen("GroundTempCalc");
+      while (it != end && !isSpace(*it)){
+        ++it;
+      }
+      return startsWith(it, end, " Completed Successfully");
+    }
+
+  }
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_path(errPath), m_follow(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    reset();
+    update();
+  }
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool follow)
+    : m_path(errPath), m_follow(follow)
+  {
+    reset();
+    update();
+  }
+
+  bool ErrorFile::update()
+  {
+    openstudio::filesystem::ifstream ifs(m_path, std::ios_base::in | std::ios_base::binary);
+    if (!ifs){
+      return false;
+    }
+
+    ifs.seekg(0, std::ios_base::end);
+    unsigned long long size = static_cast<unsigned long long>(ifs.tellg());
+    if (size < m_offset || !isSameFile(ifs)){
+      // file was truncated or replaced, e.g. by a new simulation
+      LOG(Debug, "ErrorFile '" << toString(m_path) << "' was truncated or replaced, parsing it again");
+      reset();
+    }
+
+    unsigned numMessages = numWarnings() + numSevereErrors() + numFatalErrors();
+
+    if (!m_completed && size > m_offset){
+      ifs.seekg(static_cast<std::streamoff>(m_offset), std::ios_base::beg);
+
+      // read in fixed size chunks so very large files are never held in memory at once
+      std::vector<char> buffer(1 << 20);
+      while (!m_completed && ifs){
+        ifs.read(buffer.data(), buffer.size());
+        std::streamsize n = ifs.gcount();
+        if (n <= 0){
+          break;
+        }
+        m_offset += static_cast<unsigned long long>(n);
+
+        const char* begin = buffer.data();
+        const char* end = begin + n;
+        addParsedContent(begin, end);
+        while (!m_completed && begin != end){
+          const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+          if (!newline){
+            m_partialLine.append(begin, end);
+            break;
+          }
+          if (m_partialLine.empty()){
+            parseLine(begin, newline);
+          }else{
+            m_partialLine.append(begin, newline);
+            parseLine(m_partialLine.data(), m_partialLine.data() + m_partialLine.size());
+            m_partialLine.clear();
+          }
+          begin = newline + 1;
+        }
+      }
+    }
+
+    // a growing file may have a line that is not finished yet
+    if (!m_follow && !m_completed && !m_partialLine.empty()){
+      parseLine(m_partialLine.data(), m_partialLine.data() + m_partialLine.size());
+      m_partialLine.clear();
+    }
+
+    return (numWarnings() + numSevereErrors() + numFatalErrors()) > numMessages;
   }
 
   /// get warnings
@@ -62,6 +254,20 @@ namespace energyplus {
     return m_fatalErrors;
   }
 
+  unsigned ErrorFile::numWarnings() const
+  {
+    return m_warnings.size();
+  }
+
+  unsigned ErrorFile::numSevereErrors() const
+  {
+    return m_severeErrors.size();
+  }
+
+  unsigned ErrorFile::numFatalErrors() const
+  {
+    return m_fatalErrors.size();
+  }
 
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const
@@ -75,94 +281,126 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
-  {
-    std::string line;
-
+  // bytes kept from the start and from the end of the parsed content
+  static const std::size_t parsedContentCheckSize = 256;
 
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
+  bool ErrorFile::isSameFile(std::istream& is)
+  {
+    if (m_offset == 0){
+      return true;
+    }
 
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
+    // the first line holds the EnergyPlus version and the start time of the run
+    std::string content(m_parsedHead.size(), '\0');
+    is.clear();
+    is.seekg(0, std::ios_base::beg);
+    is.read(&content[0], content.size());
+    if (!is || content != m_parsedHead){
+      is.clear();
+      return false;
+    }
 
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
+    content.assign(m_parsedTail.size(), '\0');
+    is.seekg(static_cast<std::streamoff>(m_offset - m_parsedTail.size()), std::ios_base::beg);
+    is.read(&content[0], content.size());
+    bool result = is && (content == m_parsedTail);
+    is.clear();
+    return result;
+  }
 
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
+  void ErrorFile::addParsedContent(const char* begin, const char* end)
+  {
+    std::size_t n = static_cast<std::size_t>(end - begin);
+    if (m_parsedHead.size() < parsedContentCheckSize){
+      m_parsedHead.append(begin, std::min(n, parsedContentCheckSize - m_parsedHead.size()));
+    }
+    if (n >= parsedContentCheckSize){
+      m_parsedTail.assign(end - parsedContentCheckSize, end);
+    }else{
+      m_parsedTail.append(begin, end);
+      if (m_parsedTail.size() > parsedContentCheckSize){
+        m_parsedTail.erase(0, m_parsedTail.size() - parsedContentCheckSize);
+      }
+    }
+  }
 
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
+  void ErrorFile::reset()
+  {
+    m_offset = 0;
+    m_partialLine.clear();
+    m_parsedHead.clear();
+    m_parsedTail.clear();
+    m_inMessage = false;
+    m_lastLevel.reset();
+    m_warnings.clear();
+    m_severeErrors.clear();
+    m_fatalErrors.clear();
+    m_completed = false;
+    m_completedSuccessfully = false;
+  }
 
-    // repeat count
+  void ErrorFile::parseLine(const char* begin, const char* end)
+  {
+    // files written on Windows and read in binary mode keep the carriage return
+    if (begin != end && *(end - 1) == '\r'){
+      --end;
+    }
 
+    std::string text;
 
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
+    // continue a multi line warning or error
+    if (m_inMessage){
+      if (matchWarningOrErrorContinue(begin, end, text)){
+        if (m_lastLevel){
+          boost::trim_right(text);
+          std::vector<std::string>& messages = (m_lastLevel->value() == ErrorLevel::Warning) ? m_warnings :
+                                               (m_lastLevel->value() == ErrorLevel::Severe) ? m_severeErrors : m_fatalErrors;
+          messages.back() += "\n" + text;
+        }
+        return;
+      }
+      m_inMessage = false;
+      m_lastLevel.reset();
+    }
 
-      boost::smatch matches;
+    std::string warningOrErrorType;
+    if (matchWarningOrError(begin, end, warningOrErrorType, text)){
+      boost::trim(warningOrErrorType);
+      boost::trim(text);
 
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
+      LOG(Trace, "Error parsed: " << text);
 
+      m_inMessage = true;
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+      // correctly sort warnings and errors
+      try{
+        ErrorLevel level(warningOrErrorType);
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
+        switch(level.value()){
+          case ErrorLevel::Warning:
+            m_warnings.push_back(text);
             break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
+          case ErrorLevel::Severe:
+            m_severeErrors.push_back(text);
+            break;
+          case ErrorLevel::Fatal:
+            m_fatalErrors.push_back(text);
             break;
-          }
-        }
-
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
-
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
-
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
         }
+        m_lastLevel = level;
 
-      }else if (boost::regex_match(line, completedSuccessful)
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
-        break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
-        m_completed = true;
-        m_completedSuccessfully = false;
-        break;
+      }catch(...){
+        LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
       }
-    }
 
+    }else if (matchCompletionLine(begin, end, "EnergyPlus Completed Successfully")
+              || matchGroundTempCompletedSuccessful(begin, end)) {
+      m_completed = true;
+      m_completedSuccessfully = true;
+    }else if (matchCompletionLine(begin, end, "EnergyPlus Terminated")){
+      m_completed = true;
+      m_completedSuccessfully = false;
+    }
   }
 
 } // energyplus
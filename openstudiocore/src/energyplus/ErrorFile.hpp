@@ -37,6 +37,9 @@
 #include "../utilities/core/Logger.hpp"
 
 
+#include <boost/optional.hpp>
+
+#include <istream>
 #include <string>
 #include <vector>
 
@@ -53,9 +56,17 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, parses the complete file
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor, if follow is true the file may still be growing and an unterminated last line
+    /// is not parsed until it is complete, call update to parse content appended since the last call
+    ErrorFile(const openstudio::path& errPath, bool follow);
+
+    /// parse content appended to the file since the last call, returns true if new warnings or errors were found
+    /// if the file has been truncated or replaced it is parsed again from the start
+    bool update();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -65,6 +76,15 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// number of warnings parsed so far
+    unsigned numWarnings() const;
+
+    /// number of severe errors parsed so far
+    unsigned numSevereErrors() const;
+
+    /// number of fatal errors parsed so far
+    unsigned numFatalErrors() const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
@@ -75,7 +95,26 @@ namespace energyplus {
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void reset();
+
+    void parseLine(const char* begin, const char* end);
+
+    // true if the file still starts and, up to m_offset, ends with the content parsed so far
+    bool isSameFile(std::istream& is);
+
+    // remembers the start and the end of the parsed content to detect a replaced file
+    void addParsedContent(const char* begin, const char* end);
+
+    openstudio::path m_path;
+    bool m_follow;
+    unsigned long long m_offset;
+    std::string m_partialLine;
+    std::string m_parsedHead;
+    std::string m_parsedTail;
+
+    // the previous line started or continued a warning or error, later continuation lines are appended to it
+    bool m_inMessage;
+    boost::optional<ErrorLevel> m_lastLevel;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
@@ -66,6 +66,7 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
@@ -83,11 +84,15 @@
 #include <utilities/idd/SetpointManager_MixedAir_FieldEnums.hxx>
 
 #include "../utilities/idd/IddEnums.hpp"
+#include "../utilities/core/UUID.hpp"
 
 #include <QFile>
 #include <QThread>
 
+#include <boost/algorithm/string/case_conv.hpp>
+
 #include <sstream>
+#include <unordered_map>
 
 using namespace openstudio::model;
 
@@ -123,6 +128,63 @@ Workspace ForwardTranslator::translateModel( const Model & model, ProgressBar* p
   return translateModelPrivate(modelCopy, true);
 }
 
+bool ForwardTranslator::translateModelToIdf( const Model & model, std::ostream& os, ProgressBar* progressBar )
+{
+  Model modelCopy = model.clone(true).cast<Model>();
+
+  m_progressBar = progressBar;
+  if (m_progressBar){
+    m_progressBar->setMinimum(0);
+    m_progressBar->setMaximum(model.numObjects());
+  }
+
+  translateModelToIdfObjects(modelCopy, true);
+  resolveIdfObjectReferences();
+
+  // same layout as IdfFile::print of a Workspace with an empty header, Version first
+  os << std::endl;
+  for (const IdfObject& idfObject : m_idfObjects){
+    if (idfObject.iddObject().type() == IddObjectType::Version){
+      idfObject.print(os);
+    }
+  }
+  for (const IdfObject& idfObject : m_idfObjects){
+    if (idfObject.iddObject().type() != IddObjectType::Version){
+      idfObject.print(os);
+    }
+  }
+  os.flush();
+
+  m_idfObjects.clear();
+
+  return os.good();
+}
+
+bool ForwardTranslator::translateModelToIdf( const Model & model, const openstudio::path& p, ProgressBar* progressBar )
+{
+  if (!makeParentFolder(p)){
+    LOG(Error, "Unable to create parent folder for '" << toString(p) << "'.");
+    return false;
+  }
+
+  // translated objects are small, write them through a large buffer
+  std::vector<char> buffer(1 << 20);
+  openstudio::filesystem::ofstream outFile;
+  outFile.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+  outFile.open(p);
+  if (!outFile){
+    LOG(Error, "Unable to open '" << toString(p) << "' for writing.");
+    return false;
+  }
+
+  bool result = translateModelToIdf(model, outFile, progressBar);
+  outFile.close();
+  if (!result){
+    LOG(Error, "Unable to write IDF to '" << toString(p) << "'.");
+  }
+  return result;
+}
+
 Workspace ForwardTranslator::translateModelObject( ModelObject & modelObject )
 {
   Model modelCopy;
@@ -175,7 +237,34 @@ void ForwardTranslator::setExcludeLCCObjects(bool excludeLCCObjects)
   m_excludeLCCObjects = excludeLCCObjects;
 }
 
+void ForwardTranslator::setScheduleFileDirectory(const openstudio::path& dir)
+{
+  m_scheduleFileDirectory = dir;
+}
+
+openstudio::path ForwardTranslator::scheduleFileDirectory() const
+{
+  return m_scheduleFileDirectory;
+}
+
 Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool fullModelTranslation )
+{
+  translateModelToIdfObjects(model, fullModelTranslation);
+
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject vo = workspace.versionObject();
+  OS_ASSERT(vo);
+  workspace.removeObject(vo->handle());
+
+  workspace.setFastNaming(true);
+  workspace.addObjects(m_idfObjects);
+  workspace.setFastNaming(false);
+  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+
+  return workspace;
+}
+
+void ForwardTranslator::translateModelToIdfObjects( model::Model & model, bool fullModelTranslation )
 {
   reset();
 
@@ -570,18 +659,76 @@ Workspace ForwardTranslator::translateModelPrivate( model::Model & model, bool f
     // add output requests
     this->createStandardOutputRequests();
   }
+}
 
-  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
-  OptionalWorkspaceObject vo = workspace.versionObject();
-  OS_ASSERT(vo);
-  workspace.removeObject(vo->handle());
+void ForwardTranslator::resolveIdfObjectReferences()
+{
+  // names of the translated objects by reference list, lower case like Workspace name lookups
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string> > namesByReference;
+  for (IdfObject& idfObject : m_idfObjects){
+    OptionalString name = idfObject.name();
+    if (!name){
+      continue;
+    }
+    if (name->empty()){
+      // WorkspaceObject addition creates a name when the name field has no default
+      if (!idfObject.name(true)->empty()){
+        continue;
+      }
+      name = idfObject.setName(toString(createUUID()));
+      OS_ASSERT(name);
+    }
+    std::string lowerName = boost::to_lower_copy(*name);
+    std::vector<std::string> references = idfObject.iddObject().references();
+    for (const std::string& reference : references){
+      auto names = namesByReference.find(reference);
+      if ((names != namesByReference.end()) && (names->second.find(lowerName) != names->second.end())){
+        // the first object keeps its name, rename the others like a Workspace with fast naming does
+        std::string originalDescription = idfObject.briefDescription();
+        name = idfObject.setName(toString(createUUID()));
+        OS_ASSERT(name);
+        lowerName = boost::to_lower_copy(*name);
+        LOG(Info, "Renamed " << originalDescription << " to '" << *name
+            << "' to avoid a name conflict upon WorkspaceObject addition.");
+        break;
+      }
+    }
+    for (const std::string& reference : references){
+      namesByReference[reference].insert(std::make_pair(lowerName, *name));
+    }
+  }
 
-  workspace.setFastNaming(true);
-  workspace.addObjects(m_idfObjects);
-  workspace.setFastNaming(false);
-  OS_ASSERT(workspace.getObjectsByType(IddObjectType::Version).size() == 1u);
+  for (IdfObject& idfObject : m_idfObjects){
+    for (unsigned index : idfObject.iddObject().objectListFields()){
+      OptionalString targetName = idfObject.getString(index);
+      if (!targetName || targetName->empty()){
+        continue;
+      }
 
-  return workspace;
+      std::string lowerName = boost::to_lower_copy(*targetName);
+      boost::optional<std::string> target;
+      for (const std::string& objectList : idfObject.iddObject().objectLists(index)){
+        auto names = namesByReference.find(objectList);
+        if (names != namesByReference.end()){
+          auto it = names->second.find(lowerName);
+          if (it != names->second.end()){
+            target = it->second;
+            break;
+          }
+        }
+      }
+
+      if (target){
+        if (*target != *targetName){
+          idfObject.setString(index, *target);
+        }
+      }else{
+        LOG(Warn, idfObject.briefDescription() << ", points to an object named " << *targetName
+            << " from field " << index << ", but that object cannot be located.");
+        idfObject.setString(index, "");
+      }
+    }
+  }
 }
 
 // struct for sorting children in forward translator
@@ -465,6 +465,17 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelObject( model::ModelObject & modelObject );
 
+  /** Translates the given Model and writes the EnergyPlus IDF directly to os, without building a Workspace.
+   *  Use this when the IDF is only needed to run EnergyPlus. The text is the same as saving the Workspace
+   *  returned by translateModel, except for the generated names of objects renamed to resolve name
+   *  conflicts. Returns false if the IDF could not be written.
+   */
+  bool translateModelToIdf( const model::Model & model, std::ostream& os, ProgressBar* progressBar=nullptr );
+
+  /** Translates the given Model and writes the EnergyPlus IDF to path p, overwriting any existing file.
+   */
+  bool translateModelToIdf( const model::Model & model, const openstudio::path& p, ProgressBar* progressBar=nullptr );
+
   /** Get warning messages generated by the last translation.
    */
   std::vector<LogMessage> warnings() const;
@@ -489,6 +500,16 @@ class ENERGYPLUS_API ForwardTranslator {
     */
   void setExcludeLCCObjects(bool excludeLCCObjects);
 
+  /** If dir is not empty, full year ScheduleFixedIntervals with sub-hourly values are written to csv files in dir
+    * and translated to Schedule:File objects that refer to the csv by file name only, so dir should be the
+    * directory EnergyPlus will run in. Empty by default, these schedules are then translated to Schedule:Compact.
+   */
+  void setScheduleFileDirectory(const openstudio::path& dir);
+
+  /** Returns the directory set by setScheduleFileDirectory.
+   */
+  openstudio::path scheduleFileDirectory() const;
+
  private:
 
   REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
@@ -510,6 +531,15 @@ class ENERGYPLUS_API ForwardTranslator {
    */
   Workspace translateModelPrivate( model::Model& model, bool fullModelTranslation );
 
+  /** Does the work of translateModelPrivate(), leaving the translated objects in m_idfObjects.
+   */
+  void translateModelToIdfObjects( model::Model& model, bool fullModelTranslation );
+
+  /** Resolves references between the objects in m_idfObjects the way adding them to a Workspace would,
+   *  objects with conflicting names are renamed and references to objects that were not translated are cleared.
+   */
+  void resolveIdfObjectReferences();
+
   boost::optional<IdfObject> translateAndMapModelObject( model::ModelObject & modelObject );
 
   boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow( model::AirConditionerVariableRefrigerantFlow & modelObject );
@@ -1431,6 +1461,8 @@ class ENERGYPLUS_API ForwardTranslator {
   bool m_ipTabularOutput;
 
   bool m_excludeLCCObjects;
+
+  openstudio::path m_scheduleFileDirectory;
 };
 
 namespace detail
@@ -50,6 +50,7 @@
 #include <utilities/idd/IddFactory.hxx>
 
 using namespace openstudio::model;
+using openstudio::model::detail::ErlProgramLine;
 
 using namespace std;
 
@@ -60,10 +61,6 @@ namespace energyplus {
 boost::optional<IdfObject> ForwardTranslator::translateEnergyManagementSystemProgram(EnergyManagementSystemProgram & modelObject)
 {
   boost::optional<std::string> s;
-  const int subs[] = {1};
-  std::string possible_uid;
-  size_t pos;
-  std::string newline;
 
   IdfObject idfObject(openstudio::IddObjectType::EnergyManagementSystem_Program);
   m_idfObjects.push_back(idfObject);
@@ -75,38 +72,16 @@ boost::optional<IdfObject> ForwardTranslator::translateEnergyManagementSystemPro
   }
 
   const Model m = modelObject.model();
-  boost::optional<ModelObject> mObject;
 
-  for (const IdfExtensibleGroup& eg : modelObject.extensibleGroups()) {
-    OptionalString line = eg.getString(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine);
-    // If there is actually something in the line
-    if (line) {
-      // Then, we push an extensible group (E+ fatals out if program line is empty)
-      IdfExtensibleGroup group = idfObject.pushExtensibleGroup();
-      //find uids
-      newline = line.get();
-      boost::sregex_token_iterator j(line.get().begin(), line.get().end(), uuidInString(), subs);
-
-      while (j != boost::sregex_token_iterator()) {
-        possible_uid = *j++;
-        //look to see if uid is in the model and return the object
-        UUID uid = toUUID(possible_uid);
-        mObject = m.getModelObject<model::ModelObject>(uid);
-        if (mObject) {
-          //replace uid with namestring
-          pos = newline.find(possible_uid);
-          if (pos + 38 <= newline.length()) {
-            newline.replace(pos, 38, mObject.get().nameString());
-          }
-        }
-      }
-      group.setString(EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, newline);
-      OptionalString comment = eg.fieldComment(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine);
-      if (comment) {
-        group.setFieldComment(EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, comment.get());
-      }
+  // program lines are scanned for uids once and cached by the model object
+  for (const ErlProgramLine& programLine : modelObject.getImpl<model::detail::EnergyManagementSystemProgram_Impl>()->programLines()) {
+    // E+ fatals out if program line is empty
+    IdfExtensibleGroup group = idfObject.pushExtensibleGroup();
+    //replace uids with namestrings
+    group.setString(EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, programLine.lineWithNames(m));
+    if (programLine.comment) {
+      group.setFieldComment(EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, programLine.comment.get());
     }
-
   }
   return idfObject;
 }
@@ -35,13 +35,18 @@
 #include "../../model/ScheduleFixedInterval_Impl.hpp"
 
 #include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/UUID.hpp"
 
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
+#include <utilities/idd/Schedule_File_FieldEnums.hxx>
 
 #include "../../utilities/idd/IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
+#include <cstdio>
+
 using namespace openstudio::model;
 
 using namespace std;
@@ -70,8 +75,82 @@ static unsigned addUntil(IdfObject &idfObject,unsigned fieldIndex,int hours,int
   return fieldIndex;
 }
 
+// Full year schedules with sub-hourly values are written to a csv file in dir and translated to Schedule:File,
+// a Schedule:Compact with an Until field per value is huge and slow to read
+static boost::optional<IdfObject> translateToScheduleFile(ScheduleFixedInterval & modelObject, const path& dir)
+{
+  if ((modelObject.startMonth() != 1) || (modelObject.startDay() != 1)) {
+    return boost::none;
+  }
+
+  double intervalLength = modelObject.intervalLength();
+  int minutesPerItem = static_cast<int>(intervalLength);
+  if ((intervalLength != minutesPerItem) || (minutesPerItem < 1) || (minutesPerItem >= 60) || (60 % minutesPerItem != 0)) {
+    return boost::none;
+  }
+
+  std::size_t numValues = modelObject.numExtensibleGroups();
+  std::size_t numberofHoursofData = numValues * minutesPerItem / 60;
+  if ((numValues * minutesPerItem % 60 != 0) || ((numberofHoursofData != 8760) && (numberofHoursofData != 8784))) {
+    return boost::none;
+  }
+  Vector values = modelObject.getImpl<model::detail::ScheduleFixedInterval_Impl>()->values();
+
+  path fileName = toPath(removeBraces(modelObject.handle()) + ".csv");
+  path filePath = dir / fileName;
+  try {
+    openstudio::filesystem::create_directories(dir);
+    openstudio::filesystem::ofstream file(filePath);
+    if (!file.is_open()) {
+      return boost::none;
+    }
+    // enough digits to read back the same double
+    char buffer[32];
+    for (const double value : values) {
+      std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+      file << buffer << '\n';
+    }
+    if (!file.good()) {
+      return boost::none;
+    }
+  } catch (const std::exception&) {
+    return boost::none;
+  }
+
+  IdfObject idfObject(openstudio::IddObjectType::Schedule_File);
+  // relative to the directory EnergyPlus runs in
+  idfObject.setString(Schedule_FileFields::FileName, toString(fileName));
+  idfObject.setInt(Schedule_FileFields::ColumnNumber, 1);
+  idfObject.setInt(Schedule_FileFields::RowstoSkipatTop, 0);
+  idfObject.setInt(Schedule_FileFields::NumberofHoursofData, static_cast<int>(numberofHoursofData));
+  idfObject.setString(Schedule_FileFields::ColumnSeparator, "Comma");
+  idfObject.setString(Schedule_FileFields::InterpolatetoTimestep, modelObject.interpolatetoTimestep() ? "Yes" : "No");
+  idfObject.setInt(Schedule_FileFields::MinutesperItem, minutesPerItem);
+  return idfObject;
+}
+
 boost::optional<IdfObject> ForwardTranslator::translateScheduleFixedInterval( ScheduleFixedInterval & modelObject )
 {
+  boost::optional<IdfObject> scheduleFile;
+  if (!m_scheduleFileDirectory.empty()) {
+    scheduleFile = translateToScheduleFile(modelObject, m_scheduleFileDirectory);
+  }
+  if (scheduleFile) {
+    m_idfObjects.push_back(*scheduleFile);
+
+    scheduleFile->setName(modelObject.name().get());
+
+    boost::optional<ScheduleTypeLimits> scheduleTypeLimits = modelObject.scheduleTypeLimits();
+    if (scheduleTypeLimits){
+      boost::optional<IdfObject> idfScheduleTypeLimits = translateAndMapModelObject(*scheduleTypeLimits);
+      if (idfScheduleTypeLimits){
+        scheduleFile->setString(Schedule_FileFields::ScheduleTypeLimitsName, idfScheduleTypeLimits->name().get());
+      }
+    }
+
+    return scheduleFile;
+  }
+
   IdfObject idfObject( openstudio::IddObjectType::Schedule_Compact );
 
   m_idfObjects.push_back(idfObject);
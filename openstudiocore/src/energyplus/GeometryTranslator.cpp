@@ -86,6 +86,12 @@
 #include "../utilities/idf/WorkspaceObject.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
 
+#include <boost/thread.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+
 
 
 using openstudio::IddObjectType;
@@ -102,6 +108,47 @@ using openstudio::model::SubSurface;
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // vertices of a detailed surface to be moved into another coordinate system
+    struct VertexTransform {
+      WorkspaceObject object;
+      unsigned firstVertex;
+      Point3dVector vertices;
+      Transformation transformation;
+    };
+
+    // below this many surfaces thread start up costs more than the transformations
+    const size_t minTransformsPerThread = 1000;
+
+    void transformVertexRange(std::vector<VertexTransform>& transforms, size_t begin, size_t end)
+    {
+      for (size_t i = begin; i < end; ++i){
+        transforms[i].vertices = transforms[i].transformation*transforms[i].vertices;
+      }
+    }
+
+    // each transform only touches its own vertices, so ranges can be processed concurrently
+    void transformVertices(std::vector<VertexTransform>& transforms)
+    {
+      size_t numThreads = std::max<size_t>(1, boost::thread::hardware_concurrency());
+      numThreads = std::min(numThreads, transforms.size() / minTransformsPerThread);
+      if (numThreads < 2){
+        transformVertexRange(transforms, 0, transforms.size());
+        return;
+      }
+
+      size_t chunkSize = (transforms.size() + numThreads - 1) / numThreads;
+      boost::thread_group threads;
+      for (size_t begin = chunkSize; begin < transforms.size(); begin += chunkSize){
+        threads.create_thread(std::bind(&transformVertexRange, std::ref(transforms), begin, std::min(begin + chunkSize, transforms.size())));
+      }
+      transformVertexRange(transforms, 0, chunkSize);
+      threads.join_all();
+    }
+
+  }
+
   /// test equality of coordinate systems
   bool equal(const CoordinateSystem& left, const CoordinateSystem& right)
   {
@@ -2354,6 +2401,26 @@ namespace energyplus {
 
     Transformation buildingTransformation = this->buildingTransformation();
 
+    // zone transformations are shared by every surface in the zone, compute each one once
+    std::map<Handle, Transformation> zoneTransformations;
+    auto surfaceTransformation = [&](const WorkspaceObject& zone) -> Transformation {
+      auto it = zoneTransformations.find(zone.handle());
+      if (it == zoneTransformations.end()){
+        Transformation zoneTransformation = this->zoneTransformation(zone);
+        Transformation t;
+        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
+          t = zoneTransformation.inverse()*buildingTransformation.inverse();
+        }else{
+          t = buildingTransformation*zoneTransformation;
+        }
+        it = zoneTransformations.insert(std::make_pair(zone.handle(), t)).first;
+      }
+      return it->second;
+    };
+
+    // vertices are read and written serially, only the transformation itself runs in parallel
+    std::vector<VertexTransform> transforms;
+
     for (WorkspaceObject surface : m_workspace.getObjectsByType(IddObjectType::BuildingSurface_Detailed)){
       Point3dVector vertices = getVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface);
       surface.setString(BuildingSurface_DetailedFields::NumberofVertices, "Autocalculate");
@@ -2363,16 +2430,7 @@ namespace energyplus {
           LOG(Error, "Could not find zone");
           continue;
         }
-
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(BuildingSurface_DetailedFields::NumberofVertices + 1, surface, vertices);
-        }
+        transforms.push_back(VertexTransform{surface, BuildingSurface_DetailedFields::NumberofVertices + 1, vertices, surfaceTransformation(*zone)});
       }
     }
 
@@ -2390,14 +2448,7 @@ namespace energyplus {
           LOG(Error, "Could not find zone");
           continue;
         }
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(FenestrationSurface_DetailedFields::NumberofVertices + 1, subsurface, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(FenestrationSurface_DetailedFields::NumberofVertices + 1, subsurface, vertices);
-        }
+        transforms.push_back(VertexTransform{subsurface, FenestrationSurface_DetailedFields::NumberofVertices + 1, vertices, surfaceTransformation(*zone)});
       }
     }
 
@@ -2415,31 +2466,32 @@ namespace energyplus {
           LOG(Error, "Could not find zone");
           continue;
         }
-
-        Transformation zoneTransformation = this->zoneTransformation(*zone);
-
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = zoneTransformation.inverse()*buildingTransformation.inverse()*vertices;
-          setVertices(Shading_Zone_DetailedFields::NumberofVertices + 1, zoneShading, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*zoneTransformation*vertices;
-          setVertices(Shading_Zone_DetailedFields::NumberofVertices + 1, zoneShading, vertices);
-        }
+        transforms.push_back(VertexTransform{zoneShading, Shading_Zone_DetailedFields::NumberofVertices + 1, vertices, surfaceTransformation(*zone)});
       }
     }
 
-    for (WorkspaceObject buildingShading : m_workspace.getObjectsByType(IddObjectType::Shading_Building_Detailed)){
-      Point3dVector vertices = getVertices(Shading_Building_DetailedFields::NumberofVertices + 1, buildingShading);
-      buildingShading.setString(Shading_Building_DetailedFields::NumberofVertices, "Autocalculate");
-      if (detailedCoordChange != CoordinateChange::NoChange){
-        if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
-          vertices = buildingTransformation.inverse()*vertices;
-          setVertices(Shading_Building_DetailedFields::NumberofVertices + 1, buildingShading, vertices);
-        }else if(detailedCoordChange == CoordinateChange::RelativeToAbsolute){
-          vertices = buildingTransformation*vertices;
-          setVertices(Shading_Building_DetailedFields::NumberofVertices + 1, buildingShading, vertices);
-        }
+    if (detailedCoordChange != CoordinateChange::NoChange){
+      Transformation buildingShadingTransformation;
+      if (detailedCoordChange == CoordinateChange::AbsoluteToRelative){
+        buildingShadingTransformation = buildingTransformation.inverse();
+      }else{
+        buildingShadingTransformation = buildingTransformation;
       }
+      for (WorkspaceObject buildingShading : m_workspace.getObjectsByType(IddObjectType::Shading_Building_Detailed)){
+        Point3dVector vertices = getVertices(Shading_Building_DetailedFields::NumberofVertices + 1, buildingShading);
+        buildingShading.setString(Shading_Building_DetailedFields::NumberofVertices, "Autocalculate");
+        transforms.push_back(VertexTransform{buildingShading, Shading_Building_DetailedFields::NumberofVertices + 1, vertices, buildingShadingTransformation});
+      }
+    }else{
+      for (WorkspaceObject buildingShading : m_workspace.getObjectsByType(IddObjectType::Shading_Building_Detailed)){
+        buildingShading.setString(Shading_Building_DetailedFields::NumberofVertices, "Autocalculate");
+      }
+    }
+
+    transformVertices(transforms);
+
+    for (VertexTransform& transform : transforms){
+      setVertices(transform.firstVertex, transform.object, transform.vertices);
     }
 
     for (WorkspaceObject siteShading : m_workspace.getObjectsByType(IddObjectType::Shading_Site_Detailed)){
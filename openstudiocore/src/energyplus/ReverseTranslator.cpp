@@ -133,7 +133,9 @@ boost::optional<model::Model> ReverseTranslator::loadModel(const openstudio::pat
       workspace.disconnectProgressBar(*progressBar);
     }
 
-    return this->translateWorkspace(workspace, progressBar, false);
+    // the workspace was built here and is not shared, so it can be translated without a copy
+    m_logSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ReverseTranslator"));
+    return this->translateOwnedWorkspace(workspace, progressBar);
 
   }
 
@@ -154,10 +156,16 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
     return Model();
   }
 
+  // translation modifies the workspace (geometry conversion, RunPeriod removal), work on a copy
+  return translateOwnedWorkspace(workspace.clone(), progressBar);
+}
+
+Model ReverseTranslator::translateOwnedWorkspace(const Workspace & workspace, ProgressBar* progressBar)
+{
   m_model = Model();
   m_model.setFastNaming(true);
 
-  m_workspace = workspace.clone();
+  m_workspace = workspace;
 
   m_workspaceToModelMap.clear();
 
@@ -179,7 +187,7 @@ Model ReverseTranslator::translateWorkspace(const Workspace & workspace, Progres
   m_progressBar = progressBar;
   if (m_progressBar){
     m_progressBar->setMinimum(0);
-    m_progressBar->setMaximum(workspace.numObjects());
+    m_progressBar->setMaximum(m_workspace.numObjects());
   }
 
   LOG(Trace,"Calling geometry translator.");
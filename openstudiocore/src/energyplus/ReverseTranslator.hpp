@@ -79,6 +79,9 @@ class ENERGYPLUS_API ReverseTranslator {
    */
   boost::optional<model::ModelObject> translateAndMapWorkspaceObject(const WorkspaceObject & workspaceObject);
 
+  /** Translates workspace in place, the workspace is modified so callers must not share it. */
+  model::Model translateOwnedWorkspace(const Workspace & workspace, ProgressBar* progressBar);
+
   boost::optional<model::ModelObject> translateAirLoopHVAC(const WorkspaceObject& workspaceObject);
 
   boost::optional<model::ModelObject> translateAirLoopHVACOutdoorAirSystem(const WorkspaceObject& workspaceObject);
@@ -33,6 +33,8 @@
 #include "../ErrorFile.hpp"
 
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/FilesystemHelpers.hpp"
 
 #include <resources.hxx>
 
@@ -114,4 +116,57 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
 
+TEST_F(EnergyPlusFixture,ErrorFile_Follow)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  std::string contents = openstudio::filesystem::read_as_string(path);
+
+  // simulate EnergyPlus writing the file in pieces, splitting lines and multi line messages
+  openstudio::path followPath = openstudio::toPath("./ErrorFile_Follow.err");
+  {
+    openstudio::filesystem::ofstream ofs(followPath, std::ios_base::binary | std::ios_base::trunc);
+  }
+
+  ErrorFile errorFile(followPath, true);
+  EXPECT_EQ(0u, errorFile.numWarnings());
+  EXPECT_FALSE(errorFile.completed());
+
+  unsigned lastNumMessages = 0;
+  for (size_t pos = 0; pos < contents.size(); pos += 1000){
+    {
+      openstudio::filesystem::ofstream ofs(followPath, std::ios_base::binary | std::ios_base::app);
+      ofs << contents.substr(pos, 1000);
+    }
+    bool newMessages = errorFile.update();
+    unsigned numMessages = errorFile.numWarnings() + errorFile.numSevereErrors() + errorFile.numFatalErrors();
+    EXPECT_EQ(numMessages > lastNumMessages, newMessages);
+    lastNumMessages = numMessages;
+  }
+
+  ErrorFile expected(path);
+  EXPECT_EQ(expected.warnings(), errorFile.warnings());
+  EXPECT_EQ(expected.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(expected.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
 
+  // a new run replaces the file
+  openstudio::filesystem::copy_file(resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/NoErrorsNoWarnings.err"), followPath, openstudio::filesystem::copy_option::overwrite_if_exists);
+  errorFile.update();
+  EXPECT_EQ(0u, errorFile.numWarnings());
+  EXPECT_EQ(0u, errorFile.numSevereErrors());
+  EXPECT_EQ(0u, errorFile.numFatalErrors());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  // and a larger file replaces it again, after the last run completed
+  openstudio::filesystem::copy_file(path, followPath, openstudio::filesystem::copy_option::overwrite_if_exists);
+  errorFile.update();
+  EXPECT_EQ(expected.warnings(), errorFile.warnings());
+  EXPECT_EQ(expected.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(expected.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_FALSE(errorFile.completedSuccessfully());
+
+  openstudio::filesystem::remove(followPath);
+}
@@ -52,7 +52,9 @@
 #include "../../model/Building.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/SpaceType.hpp"
 #include "../../model/Lights.hpp"
+#include "../../model/LightsDefinition.hpp"
 #include "../../model/AirLoopHVAC.hpp"
 #include "../../model/Schedule.hpp"
 #include "../../model/ScheduleCompact.hpp"
@@ -146,6 +148,81 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ExampleModel) {
   workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToIdf) {
+  Model model = exampleModel();
+
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::stringstream workspaceIdf;
+  workspace.toIdfFile().print(workspaceIdf);
+
+  std::stringstream streamedIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, streamedIdf));
+  EXPECT_EQ(0u, forwardTranslator.errors().size());
+  EXPECT_EQ(workspaceIdf.str(), streamedIdf.str());
+
+  openstudio::path p = toPath("./example_streamed.idf");
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, p));
+  OptionalIdfFile idfFile = IdfFile::load(p, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  EXPECT_EQ(workspace.toIdfFile().objects().size(), idfFile->objects().size());
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToIdf_NameConflict) {
+  Model model;
+
+  // the Zone and the ZoneList share the ZoneAndZoneListNames reference list
+  ThermalZone thermalZone(model);
+  thermalZone.setName("Office");
+  SpaceType spaceType(model);
+  spaceType.setName("Office");
+  LightsDefinition lightsDefinition(model);
+  Lights lights(lightsDefinition);
+  lights.setSpaceType(spaceType);
+  Space space(model);
+  space.setThermalZone(thermalZone);
+  space.setSpaceType(spaceType);
+
+  ForwardTranslator forwardTranslator;
+  std::stringstream streamedIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, streamedIdf));
+  OptionalIdfFile idfFile = IdfFile::load(streamedIdf, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+
+  std::vector<IdfObject> zones = idfFile->getObjectsByType(IddObjectType::Zone);
+  std::vector<IdfObject> zoneLists = idfFile->getObjectsByType(IddObjectType::ZoneList);
+  ASSERT_EQ(1u, zones.size());
+  ASSERT_EQ(1u, zoneLists.size());
+  ASSERT_TRUE(zones[0].name());
+  ASSERT_TRUE(zoneLists[0].name());
+  EXPECT_FALSE(boost::iequals(zones[0].name().get(), zoneLists[0].name().get()));
+  EXPECT_TRUE(boost::iequals("Office", zones[0].name().get()) || boost::iequals("Office", zoneLists[0].name().get()));
+}
+
+TEST_F(EnergyPlusFixture,ForwardTranslator_TranslateModelToIdf_UnnamedObject) {
+  Model model;
+  StandardOpaqueMaterial material(model);
+  EXPECT_TRUE(material.setName(""));
+  ASSERT_TRUE(material.name());
+  ASSERT_TRUE(material.name()->empty());
+
+  // both paths name the translated material, like WorkspaceObject addition does
+  ForwardTranslator forwardTranslator;
+  Workspace workspace = forwardTranslator.translateModel(model);
+  std::vector<WorkspaceObject> workspaceMaterials = workspace.getObjectsByType(IddObjectType::Material);
+  ASSERT_EQ(1u, workspaceMaterials.size());
+  ASSERT_TRUE(workspaceMaterials[0].name());
+  EXPECT_FALSE(workspaceMaterials[0].name()->empty());
+
+  std::stringstream streamedIdf;
+  EXPECT_TRUE(forwardTranslator.translateModelToIdf(model, streamedIdf));
+  OptionalIdfFile idfFile = IdfFile::load(streamedIdf, IddFileType::EnergyPlus);
+  ASSERT_TRUE(idfFile);
+  std::vector<IdfObject> streamedMaterials = idfFile->getObjectsByType(IddObjectType::Material);
+  ASSERT_EQ(1u, streamedMaterials.size());
+  ASSERT_TRUE(streamedMaterials[0].name());
+  EXPECT_FALSE(streamedMaterials[0].name()->empty());
+}
 
 TEST_F(EnergyPlusFixture,ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
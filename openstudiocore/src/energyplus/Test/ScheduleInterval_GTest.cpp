@@ -36,6 +36,7 @@
 #include "../../utilities/data/TimeSeries.hpp"
 #include "../../utilities/time/Date.hpp"
 #include "../../utilities/time/Time.hpp"
+#include "../../utilities/core/Filesystem.hpp"
 
 #include "../../model/Model.hpp"
 #include "../../model/ScheduleInterval.hpp"
@@ -46,9 +47,11 @@
 #include "../../model/ScheduleVariableInterval_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
+#include <utilities/idd/Schedule_File_FieldEnums.hxx>
 
 #include <boost/regex.hpp>
 
+#include <fstream>
 #include <sstream>
 
 
@@ -385,6 +388,64 @@ TEST_F(EnergyPlusFixture,ForwardTranslator_ScheduleFixedInterval_20hours)
 }
 
 
+TEST_F(EnergyPlusFixture,ForwardTranslator_ScheduleFixedInterval_ScheduleFile)
+{
+  // Create a full year of 15 minute values
+  Vector values = linspace(1, 35040, 35040);
+
+  TimeSeries timeseries(DateTime(Date(MonthOfYear::Jan, 1), Time(0,0,15)), Time(0,0,15), values, "");
+
+  Model model;
+
+  boost::optional<ScheduleInterval> scheduleInterval = ScheduleInterval::fromTimeSeries(timeseries, model);
+  ASSERT_TRUE(scheduleInterval);
+  ASSERT_TRUE(scheduleInterval->optionalCast<ScheduleFixedInterval>());
+  EXPECT_EQ(35040u, scheduleInterval->cast<ScheduleFixedInterval>().getImpl<detail::ScheduleFixedInterval_Impl>()->values().size());
+
+  // Sub-hourly full year schedules are translated to Schedule:Compact by default
+  ForwardTranslator ft;
+  Workspace workspace = ft.translateModel(model);
+  EXPECT_EQ(1u, workspace.getObjectsByType(IddObjectType::Schedule_Compact).size());
+  EXPECT_EQ(0u, workspace.getObjectsByType(IddObjectType::Schedule_File).size());
+
+  // and to Schedule:File with a csv in the schedule file directory if one is set
+  path dir = toPath("./ScheduleFixedInterval_ScheduleFile");
+  if (exists(dir)) {
+    openstudio::filesystem::remove_all(dir);
+  }
+  ft.setScheduleFileDirectory(dir);
+  EXPECT_EQ(dir, ft.scheduleFileDirectory());
+  workspace = ft.translateModel(model);
+
+  EXPECT_EQ(0u, workspace.getObjectsByType(IddObjectType::Schedule_Compact).size());
+  std::vector<WorkspaceObject> objects = workspace.getObjectsByType(IddObjectType::Schedule_File);
+  ASSERT_EQ(1u, objects.size());
+
+  EXPECT_EQ(scheduleInterval->nameString(), objects[0].nameString());
+  EXPECT_EQ(1, objects[0].getInt(Schedule_FileFields::ColumnNumber).get());
+  EXPECT_EQ(0, objects[0].getInt(Schedule_FileFields::RowstoSkipatTop).get());
+  EXPECT_EQ(8760, objects[0].getInt(Schedule_FileFields::NumberofHoursofData).get());
+  EXPECT_EQ(15, objects[0].getInt(Schedule_FileFields::MinutesperItem).get());
+
+  path fileName = toPath(objects[0].getString(Schedule_FileFields::FileName).get());
+  EXPECT_FALSE(fileName.has_parent_path());
+  path p = dir / fileName;
+  ASSERT_TRUE(exists(p));
+
+  std::ifstream file(toSystemFilename(p));
+  std::string line;
+  std::vector<std::string> lines;
+  while (std::getline(file, line)) {
+    lines.push_back(line);
+  }
+  file.close();
+  openstudio::filesystem::remove_all(dir);
+
+  ASSERT_EQ(35040u, lines.size());
+  EXPECT_EQ("1", lines.front());
+  EXPECT_EQ("35040", lines.back());
+}
+
 TEST_F(EnergyPlusFixture,ForwardTranslator_ScheduleFixedInterval_ThreePoint)
 {
   // Create the values vector
@@ -38,6 +38,8 @@
 #include "ModelExtensibleGroup.hpp"
 #include "Model.hpp"
 
+#include "../utilities/idf/IdfExtensibleGroup.hpp"
+
 #include "../utilities/core/String.hpp"
 #include "../utilities/core/StringHelpers.hpp"
 #include "../utilities/core/UUID.hpp"
@@ -50,12 +52,62 @@ namespace model {
 
 namespace detail {
 
+  ErlProgramLine::ErlProgramLine(const IdfExtensibleGroup& group, unsigned programLineIndex)
+  {
+    boost::optional<std::string> value = group.getString(programLineIndex, true);
+    OS_ASSERT(value);
+    line = value.get();
+    comment = group.fieldComment(programLineIndex, false);
+    references = findUUIDsInString(line);
+  }
+
+  std::string ErlProgramLine::formattedLine() const
+  {
+    std::string result = line;
+    if (comment) {
+      //remove space after !
+      std::string temp = comment.get();
+      boost::erase_first(temp, " ");
+      //add space between end of program line and comment
+      if (!temp.empty()) {
+        result += " " + temp;
+      }
+    }
+    //add newline character
+    result += '\n';
+    return result;
+  }
+
+  std::string ErlProgramLine::lineWithNames(const Model& model) const
+  {
+    if (references.empty()) {
+      return line;
+    }
+
+    std::string result;
+    std::string::size_type last = 0;
+    for (const auto& reference : references) {
+      boost::optional<ModelObject> modelObject = model.getModelObject<ModelObject>(reference.second);
+      result.append(line, last, reference.first - last);
+      if (modelObject) {
+        //replace uid with namestring
+        result += modelObject->nameString();
+      } else {
+        result.append(line, reference.first, 38);
+      }
+      last = reference.first + 38;
+    }
+    result.append(line, last, std::string::npos);
+    return result;
+  }
+
   EnergyManagementSystemProgram_Impl::EnergyManagementSystemProgram_Impl(const IdfObject& idfObject,
                                                                          Model_Impl* model,
                                                                          bool keepHandle)
     : ModelObject_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == EnergyManagementSystemProgram::iddObjectType());
+    this->EnergyManagementSystemProgram_Impl::onChange.connect<EnergyManagementSystemProgram_Impl, &EnergyManagementSystemProgram_Impl::clearCachedProgramLines>(this);
   }
 
   EnergyManagementSystemProgram_Impl::EnergyManagementSystemProgram_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -64,13 +116,16 @@ namespace detail {
     : ModelObject_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == EnergyManagementSystemProgram::iddObjectType());
+    this->EnergyManagementSystemProgram_Impl::onChange.connect<EnergyManagementSystemProgram_Impl, &EnergyManagementSystemProgram_Impl::clearCachedProgramLines>(this);
   }
 
   EnergyManagementSystemProgram_Impl::EnergyManagementSystemProgram_Impl(const EnergyManagementSystemProgram_Impl& other,
                                                                          Model_Impl* model,
                                                                          bool keepHandle)
     : ModelObject_Impl(other,model,keepHandle)
-  {}
+  {
+    this->EnergyManagementSystemProgram_Impl::onChange.connect<EnergyManagementSystemProgram_Impl, &EnergyManagementSystemProgram_Impl::clearCachedProgramLines>(this);
+  }
 
   const std::vector<std::string>& EnergyManagementSystemProgram_Impl::outputVariableNames() const
   {
@@ -84,29 +139,9 @@ namespace detail {
 
   std::string EnergyManagementSystemProgram_Impl::body() const {
     //return program body as string
-
-    // loop through extensible groups and add ProgramLine to body string.
     std::string body;
-    boost::optional<std::string> comment;
-
-    auto groups = extensibleGroups();
-    for (auto group = groups.begin(); group != groups.end(); ++group) {
-      //get program line content
-      const auto & line = group->getString(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, true);
-      OS_ASSERT(line);
-      body += line.get();
-      //get non-default comments if they exist
-      comment = group->fieldComment(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, false);
-      if (comment.is_initialized()) {
-        //remove space after !
-        boost::erase_first(comment.get()," ");
-        //add space between end of program line and comment
-        if (!comment.get().empty()) {
-          body += " " + comment.get();
-        }
-      }
-      //add newline character
-      body += '\n';
+    for (const ErlProgramLine& programLine : programLines()) {
+      body += programLine.formattedLine();
     }
     return body;
   }
@@ -252,34 +287,8 @@ namespace detail {
   std::vector<std::string> EnergyManagementSystemProgram_Impl::lines() const {
     //return vector of lines from body
     std::vector<std::string> result;
-    boost::optional<std::string> comment;
-    std::string whole_line;
-
-    // loop through extensible groups and add ProgramLine to vector result.
-    auto groups = extensibleGroups();
-
-    for (auto group = groups.begin(); group != groups.end(); ++group) {
-      //clear out whole_line
-      whole_line.clear();
-      //get program line content
-      const auto & line = group->getString(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, true);
-      OS_ASSERT(line);
-      //add programLine to whole_line
-      whole_line += line.get();
-      //get non-default comments if they exist
-      comment = group->fieldComment(OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine, false);
-      if (comment.is_initialized()) {
-        //remove space after !
-        boost::erase_first(comment.get(), " ");
-        //add space between end of program line and comment
-        if (!comment.get().empty()) {
-          whole_line += " " + comment.get();
-        }
-      }
-      //add newline character
-      whole_line += '\n';
-      //add whole_line to vector
-      result.push_back(whole_line);
+    for (const ErlProgramLine& programLine : programLines()) {
+      result.push_back(programLine.formattedLine());
     }
     return result;
   }
@@ -311,27 +320,16 @@ namespace detail {
   std::vector<ModelObject> EnergyManagementSystemProgram_Impl::referencedObjects() const {
     //return vector of model objects that are referenced in program
     std::vector<ModelObject> result;
-    const int subs[] = {1};
-    std::string possible_uid;
 
     const Model m = this->model();
     boost::optional<ModelObject> modelObject;
 
-    boost::optional<std::vector<std::string>> body = this->lines();
-    if (body.is_initialized()) {
-      //assume body is a vector of strings
-      for (size_t i = 0; i < body.get().size(); i++) {
-        //find uids
-        boost::sregex_token_iterator j(body.get().at(i).begin(), body.get().at(i).end(), uuidInString(), subs);
-
-        while (j != boost::sregex_token_iterator()) {
-          possible_uid = *j++;
-          //look to see if uid is in the model and return the object
-          UUID uid = toUUID(possible_uid);
-          modelObject = m.getModelObject<model::ModelObject>(uid);
-          if (modelObject) {
-            result.push_back(modelObject.get());
-          }
+    for (const ErlProgramLine& programLine : programLines()) {
+      for (const auto& reference : programLine.references) {
+        //look to see if uid is in the model and return the object
+        modelObject = m.getModelObject<model::ModelObject>(reference.second);
+        if (modelObject) {
+          result.push_back(modelObject.get());
         }
       }
     }
@@ -341,34 +339,38 @@ namespace detail {
   std::vector<std::string> EnergyManagementSystemProgram_Impl::invalidReferencedObjects() const {
     //return vector of body lines that contain missing uid strings for invalid referenced objects
     std::vector<std::string> result;
-    const int subs[] = {1};
-    std::string possible_uid;
 
     const Model m = this->model();
     boost::optional<ModelObject> modelObject;
 
-    boost::optional<std::vector<std::string>> body = this->lines();
-    if (body.is_initialized()) {
-      //assume body is a vector of strings
-      for (size_t i = 0; i < body.get().size(); i++) {
-        //find uids
-        boost::sregex_token_iterator j(body.get().at(i).begin(), body.get().at(i).end(), uuidInString(), subs);
-
-        while (j != boost::sregex_token_iterator()) {
-          possible_uid = *j++;
-          //look to see if uid is in the model and return the object
-          UUID uid = toUUID(possible_uid);
-          modelObject = m.getModelObject<model::ModelObject>(uid);
-          if (!modelObject) {
-            result.push_back(body.get().at(i));
-            break;
-          }
+    for (const ErlProgramLine& programLine : programLines()) {
+      for (const auto& reference : programLine.references) {
+        //look to see if uid is in the model and return the object
+        modelObject = m.getModelObject<model::ModelObject>(reference.second);
+        if (!modelObject) {
+          result.push_back(programLine.formattedLine());
+          break;
         }
       }
     }
     return result;
   }
 
+  const std::vector<ErlProgramLine>& EnergyManagementSystemProgram_Impl::programLines() const {
+    if (!m_cachedProgramLines) {
+      std::vector<ErlProgramLine> result;
+      for (const IdfExtensibleGroup& group : extensibleGroups()) {
+        result.push_back(ErlProgramLine(group, OS_EnergyManagementSystem_ProgramExtensibleFields::ProgramLine));
+      }
+      m_cachedProgramLines = result;
+    }
+    return m_cachedProgramLines.get();
+  }
+
+  void EnergyManagementSystemProgram_Impl::clearCachedProgramLines() {
+    m_cachedProgramLines.reset();
+  }
+
 } // detail
 
 EnergyManagementSystemProgram::EnergyManagementSystemProgram(const Model& model)
@@ -33,11 +33,42 @@
 #include "ModelAPI.hpp"
 #include "ModelObject_Impl.hpp"
 
+#include "../utilities/core/UUID.hpp"
+
 namespace openstudio {
+
+class IdfExtensibleGroup;
+
 namespace model {
 
+class Model;
+
 namespace detail {
 
+  /** A line of Erl from an EnergyManagementSystemProgram or EnergyManagementSystemSubroutine.  Lines are
+   *  scanned for object handles once and cached by the owning object, so that finding referenced objects and
+   *  substituting handles with names do not require searching the text again. */
+  struct MODEL_API ErlProgramLine {
+
+    /// parse a program line from an extensible group
+    ErlProgramLine(const IdfExtensibleGroup& group, unsigned programLineIndex);
+
+    /// the program line as returned by lines(), including the comment and a trailing newline
+    std::string formattedLine() const;
+
+    /// the program line with referenced handles replaced by object names, handles not in model are kept
+    std::string lineWithNames(const Model& model) const;
+
+    /// program line, without comment
+    std::string line;
+
+    /// comment for the program line, if any
+    boost::optional<std::string> comment;
+
+    /// position in line of each handle referenced, including curly brackets
+    std::vector<std::pair<std::string::size_type, UUID> > references;
+  };
+
   /** EnergyManagementSystemProgram_Impl is a ModelObject_Impl that is the implementation class for EnergyManagementSystemProgram.*/
   class MODEL_API EnergyManagementSystemProgram_Impl : public ModelObject_Impl {
    public:
@@ -78,6 +109,8 @@ namespace detail {
 
     std::vector<std::string> invalidReferencedObjects() const;
 
+    /** Program lines scanned for object references, cached until this object changes. */
+    const std::vector<ErlProgramLine>& programLines() const;
 
     //@}
     /** @name Setters */
@@ -99,6 +132,10 @@ namespace detail {
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.EnergyManagementSystemProgram");
+
+    void clearCachedProgramLines();
+
+    mutable boost::optional<std::vector<ErlProgramLine> > m_cachedProgramLines;
   };
 
 } // detail
@@ -32,6 +32,7 @@
 
 #include "ModelAPI.hpp"
 #include "ModelObject_Impl.hpp"
+#include "EnergyManagementSystemProgram_Impl.hpp"
 
 namespace openstudio {
 namespace model {
@@ -78,6 +79,9 @@ namespace detail {
 
     std::vector<std::string> invalidReferencedObjects() const;
 
+    /** Subroutine lines scanned for object references, cached until this object changes. */
+    const std::vector<ErlProgramLine>& programLines() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -98,6 +102,10 @@ namespace detail {
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.EnergyManagementSystemSubroutine");
+
+    void clearCachedProgramLines();
+
+    mutable boost::optional<std::vector<ErlProgramLine> > m_cachedProgramLines;
   };
 
 } // detail
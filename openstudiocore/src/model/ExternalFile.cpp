@@ -40,8 +40,12 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/FilesystemHelpers.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
 #include <unordered_map>
 #include "ScheduleFile_Impl.hpp"
 
@@ -56,6 +60,7 @@ namespace detail {
     : ResourceObject_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == ExternalFile::iddObjectType());
+    this->ExternalFile_Impl::onChange.connect<ExternalFile_Impl, &ExternalFile_Impl::clearCachedCSVColumns>(this);
   }
 
   ExternalFile_Impl::ExternalFile_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -64,13 +69,16 @@ namespace detail {
     : ResourceObject_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == ExternalFile::iddObjectType());
+    this->ExternalFile_Impl::onChange.connect<ExternalFile_Impl, &ExternalFile_Impl::clearCachedCSVColumns>(this);
   }
 
   ExternalFile_Impl::ExternalFile_Impl(const ExternalFile_Impl& other,
                                        Model_Impl* model,
                                        bool keepHandle)
     : ResourceObject_Impl(other,model,keepHandle)
-  {}
+  {
+    this->ExternalFile_Impl::onChange.connect<ExternalFile_Impl, &ExternalFile_Impl::clearCachedCSVColumns>(this);
+  }
 
   const std::vector<std::string>& ExternalFile_Impl::outputVariableNames() const
   {
@@ -180,6 +188,121 @@ namespace detail {
     return result;
   }
 
+  // a separator of ' ' is the Fixed format, fields are separated by any run of spaces or tabs
+  static std::vector<Vector> parseCSVColumns(const std::string& text, char separator, unsigned rowsToSkip)
+  {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const bool fixed = (separator == ' ');
+    const std::string::size_type n = text.size();
+
+    std::vector<std::vector<double> > columns;
+    std::string::size_type lineBegin = 0;
+    unsigned row = 0;
+    unsigned dataRows = 0;
+    while (lineBegin < n) {
+      std::string::size_type lineEnd = text.find('\n', lineBegin);
+      if (lineEnd == std::string::npos) {
+        lineEnd = n;
+      }
+      std::string::size_type next = lineEnd + 1;
+      if ((lineEnd > lineBegin) && (text[lineEnd - 1] == '\r')) {
+        --lineEnd;
+      }
+
+      if ((row++ >= rowsToSkip) && (lineEnd > lineBegin)) {
+        unsigned column = 0;
+        std::string::size_type fieldBegin = lineBegin;
+        while (fieldBegin <= lineEnd) {
+          if (fixed) {
+            while ((fieldBegin < lineEnd) && ((text[fieldBegin] == ' ') || (text[fieldBegin] == '\t'))) {
+              ++fieldBegin;
+            }
+            if ((fieldBegin == lineEnd) && (column > 0)) {
+              break;
+            }
+          }
+
+          std::string::size_type fieldEnd = fixed ? text.find_first_of(" \t", fieldBegin) : text.find(separator, fieldBegin);
+          if ((fieldEnd == std::string::npos) || (fieldEnd > lineEnd)) {
+            fieldEnd = lineEnd;
+          }
+
+          // strtod stops at the separator, anything other than trailing blanks makes the field invalid
+          const char* begin = text.c_str() + fieldBegin;
+          char* end = nullptr;
+          double value = std::strtod(begin, &end);
+          std::string::size_type parsedEnd = fieldBegin + (end - begin);
+          while ((parsedEnd < fieldEnd) && ((text[parsedEnd] == ' ') || (text[parsedEnd] == '\t'))) {
+            ++parsedEnd;
+          }
+          if ((end == begin) || (parsedEnd != fieldEnd)) {
+            value = nan;
+          }
+
+          if (column >= columns.size()) {
+            columns.push_back(std::vector<double>(dataRows, nan));
+          }
+          columns[column].push_back(value);
+          ++column;
+
+          fieldBegin = fieldEnd + 1;
+        }
+
+        for (; column < columns.size(); ++column) {
+          columns[column].push_back(nan);
+        }
+        ++dataRows;
+      }
+
+      lineBegin = next;
+    }
+
+    std::vector<Vector> result;
+    result.reserve(columns.size());
+    for (const auto& column : columns) {
+      Vector values(column.size());
+      std::copy(column.begin(), column.end(), values.begin());
+      result.push_back(values);
+    }
+    return result;
+  }
+
+  std::shared_ptr<const std::vector<Vector> > ExternalFile_Impl::csvColumns(char separator, unsigned rowsToSkip) const
+  {
+    path p = filePath();
+    if (!openstudio::filesystem::exists(p)) {
+      LOG(Warn, "Cannot find file \"" << p << "\" for " << briefDescription());
+      return nullptr;
+    }
+
+    // drop everything parsed from an older version of the file
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time_as_time_t(p);
+    std::uintmax_t fileSize = openstudio::filesystem::file_size(p);
+    if ((p != m_cachedCSVPath) || (lastWriteTime != m_cachedCSVLastWriteTime) || (fileSize != m_cachedCSVFileSize)) {
+      m_cachedCSVColumns.clear();
+      m_cachedCSVPath = p;
+      m_cachedCSVLastWriteTime = lastWriteTime;
+      m_cachedCSVFileSize = fileSize;
+    }
+
+    std::pair<char, unsigned> key(separator, rowsToSkip);
+    auto it = m_cachedCSVColumns.find(key);
+    if (it != m_cachedCSVColumns.end()) {
+      return it->second;
+    }
+
+    std::shared_ptr<const std::vector<Vector> > result =
+      std::make_shared<const std::vector<Vector> >(parseCSVColumns(openstudio::filesystem::read_as_string(p), separator, rowsToSkip));
+    m_cachedCSVColumns[key] = result;
+    return result;
+  }
+
+  void ExternalFile_Impl::clearCachedCSVColumns()
+  {
+    m_cachedCSVColumns.clear();
+    m_cachedCSVPath = path();
+  }
+
 } // detail
 
 boost::optional<ExternalFile> ExternalFile::getExternalFile(const Model& model, const std::string &filename)
@@ -33,6 +33,13 @@
 #include "ModelAPI.hpp"
 #include "ResourceObject_Impl.hpp"
 
+#include "../utilities/data/Vector.hpp"
+
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <memory>
+
 namespace openstudio {
 namespace model {
 
@@ -102,6 +109,12 @@ namespace detail {
 
     std::vector<ScheduleFile> scheduleFiles() const;
 
+    /** Returns the columns of this file read as delimited numeric text, skipping rowsToSkip rows at
+     *  the top. Fields that are missing or not numeric are NaN. The file is read once per separator
+     *  and rowsToSkip, the parsed columns are shared by all callers until this object or the file on
+     *  disk changes. Returns a null pointer if the file cannot be read. */
+    std::shared_ptr<const std::vector<Vector> > csvColumns(char separator, unsigned rowsToSkip) const;
+
     //@}
    protected:
      bool setFileName(const std::string& fileName);
@@ -110,6 +123,13 @@ namespace detail {
    private:
      REGISTER_LOGGER("openstudio.model.ExternalFile");
 
+     void clearCachedCSVColumns();
+
+     mutable std::map<std::pair<char, unsigned>, std::shared_ptr<const std::vector<Vector> > > m_cachedCSVColumns;
+     mutable path m_cachedCSVPath;
+     mutable std::time_t m_cachedCSVLastWriteTime = 0;
+     mutable std::uintmax_t m_cachedCSVFileSize = 0;
+
   };
 
 } // detail
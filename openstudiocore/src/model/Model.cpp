@@ -180,6 +180,20 @@ namespace detail {
 
     clearCachedData();
     otherImpl->clearCachedData();
+
+    // objects have moved between models, make sure changes to them clear the right resolved defaults
+    for (const WorkspaceObject& object : objects()){
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      mf_disconnectResolvedDefaultsSignals(impl);
+      otherImpl->mf_disconnectResolvedDefaultsSignals(impl);
+      mf_connectResolvedDefaultsSignals(impl);
+    }
+    for (const WorkspaceObject& object : otherImpl->objects()){
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      mf_disconnectResolvedDefaultsSignals(impl);
+      otherImpl->mf_disconnectResolvedDefaultsSignals(impl);
+      otherImpl->mf_connectResolvedDefaultsSignals(impl);
+    }
   }
 
   void Model_Impl::createComponentWatchers() {
@@ -207,6 +221,8 @@ namespace detail {
       result = std::shared_ptr<GenericModelObject_Impl>(new GenericModelObject_Impl(object, this, keepHandle));
     }
 
+    mf_connectResolvedDefaultsSignals(result);
+
     return result;
   }
 
@@ -238,6 +254,8 @@ namespace detail {
       }
     }
 
+    mf_connectResolvedDefaultsSignals(result);
+
     return result;
   }
 
@@ -978,6 +996,86 @@ namespace detail {
     }
   }
 
+  bool Model_Impl::cachedDefaultConstruction(const Handle& spaceHandle, const std::string& surfaceKey,
+                                             Handle& constructionHandle, int& searchDistance) const
+  {
+    auto it = m_cachedDefaultConstructions.find(std::make_pair(spaceHandle, surfaceKey));
+    if (it == m_cachedDefaultConstructions.end()){
+      return false;
+    }
+    constructionHandle = it->second.first;
+    searchDistance = it->second.second;
+    return true;
+  }
+
+  void Model_Impl::setCachedDefaultConstruction(const Handle& spaceHandle, const std::string& surfaceKey,
+                                                const Handle& constructionHandle, int searchDistance) const
+  {
+    m_cachedDefaultConstructions[std::make_pair(spaceHandle, surfaceKey)] = std::make_pair(constructionHandle, searchDistance);
+  }
+
+  bool Model_Impl::cachedDefaultSchedule(const Handle& spaceHandle, int defaultScheduleType, Handle& scheduleHandle) const
+  {
+    auto it = m_cachedDefaultSchedules.find(std::make_pair(spaceHandle, defaultScheduleType));
+    if (it == m_cachedDefaultSchedules.end()){
+      return false;
+    }
+    scheduleHandle = it->second;
+    return true;
+  }
+
+  void Model_Impl::setCachedDefaultSchedule(const Handle& spaceHandle, int defaultScheduleType, const Handle& scheduleHandle) const
+  {
+    m_cachedDefaultSchedules[std::make_pair(spaceHandle, defaultScheduleType)] = scheduleHandle;
+  }
+
+  void Model_Impl::mf_connectResolvedDefaultsSignals(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& object)
+  {
+    switch (object->iddObject().type().value()){
+      case IddObjectType::OS_Space:
+      case IddObjectType::OS_SpaceType:
+      case IddObjectType::OS_BuildingStory:
+      case IddObjectType::OS_Building:
+      case IddObjectType::OS_DefaultConstructionSet:
+      case IddObjectType::OS_DefaultSurfaceConstructions:
+      case IddObjectType::OS_DefaultSubSurfaceConstructions:
+      case IddObjectType::OS_DefaultScheduleSet:
+        // all fields used to resolve defaults are object list fields, so relationship changes are sufficient
+        object.get()->openstudio::detail::WorkspaceObject_Impl::onRelationshipChange.connect<Model_Impl, &Model_Impl::clearCachedResolvedDefaultsOnRelationshipChange>(this);
+        object.get()->openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace.connect<Model_Impl, &Model_Impl::clearCachedResolvedDefaultsOnRemove>(this);
+        clearCachedResolvedDefaults();
+        break;
+      default:
+        break;
+    }
+  }
+
+  void Model_Impl::mf_disconnectResolvedDefaultsSignals(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& object)
+  {
+    object.get()->openstudio::detail::WorkspaceObject_Impl::onRelationshipChange.disconnect<Model_Impl, &Model_Impl::clearCachedResolvedDefaultsOnRelationshipChange>(this);
+    object.get()->openstudio::detail::WorkspaceObject_Impl::onRemoveFromWorkspace.disconnect<Model_Impl, &Model_Impl::clearCachedResolvedDefaultsOnRemove>(this);
+  }
+
+  void Model_Impl::clearCachedResolvedDefaults()
+  {
+    if (!m_cachedDefaultConstructions.empty()){
+      m_cachedDefaultConstructions.clear();
+    }
+    if (!m_cachedDefaultSchedules.empty()){
+      m_cachedDefaultSchedules.clear();
+    }
+  }
+
+  void Model_Impl::clearCachedResolvedDefaultsOnRemove(const Handle&)
+  {
+    clearCachedResolvedDefaults();
+  }
+
+  void Model_Impl::clearCachedResolvedDefaultsOnRelationshipChange(int, Handle, Handle)
+  {
+    clearCachedResolvedDefaults();
+  }
+
   void Model_Impl::clearCachedData()
   {
     Handle dummy;
@@ -987,6 +1085,7 @@ namespace detail {
     clearCachedRunPeriod(dummy);
     clearCachedYearDescription(dummy);
     clearCachedWeatherFile(dummy);
+    clearCachedResolvedDefaults();
   }
 
   void Model_Impl::clearCachedBuilding(const Handle &)
@@ -1125,7 +1224,11 @@ Model::Model(const openstudio::Workspace& workspace)
 
 boost::optional<Model> Model::load(const path& osmPath) {
   OptionalModel result;
-  OptionalIdfFile oIdfFile = IdfFile::load(osmPath,IddFileType::OpenStudio);
+  // a snapshot left by the previous workflow step is much cheaper to load than the osm itself
+  OptionalIdfFile oIdfFile = IdfFile::loadCurrentSnapshot(osmPath,IddFileType::OpenStudio);
+  if (!oIdfFile) {
+    oIdfFile = IdfFile::load(osmPath,IddFileType::OpenStudio);
+  }
   if (oIdfFile) {
     try {
       result = Model(*oIdfFile);
@@ -395,7 +395,9 @@ class MODEL_API Model : public openstudio::Workspace {
 
   //@}
 
-  /** Load Model from file, attempts to load WorkflowJSON from standard path. */
+  /** Load Model from file, attempts to load WorkflowJSON from standard path. If a snapshot
+   *  saved for the current contents of osmPath (see Workspace::saveSnapshot) exists, it is loaded
+   *  instead of the osm. */
   static boost::optional<Model> load(const path& osmPath);
 
   /** Load Model and WorkflowJSON from files, fails if either osm or workflowJSON cannot be loaded. */
@@ -713,26 +713,8 @@ namespace detail {
       return result;
     }
 
-    // Query the Intialization Summary -> Component Sizing table to get
-    // the row names that contains information for this component.
-    std::stringstream rowsQuery;
-    rowsQuery << "SELECT RowName ";
-    rowsQuery << "FROM tabulardatawithstrings ";
-    rowsQuery << "WHERE ReportName='Initialization Summary' ";
-    rowsQuery << "AND ReportForString='Entire Facility' ";
-    rowsQuery << "AND TableName = 'Component Sizing Information' ";
-    rowsQuery << "AND Value='" + sqlName + "'";
-
-    boost::optional<std::vector<std::string>> rowNames = model().sqlFile().get().execAndReturnVectorOfString(rowsQuery.str());
-
-    // Warn if the query failed
-    if (!rowNames) {
-      LOG(Warn, "Could not find a component called '" + sqlName + "' in any rows of the Initialization Summary Component Sizing table.");
-      return result;
-    }
-
-    // Query each row of the Intialization Summary -> Component Sizing table
-    // that contains this component to get the desired value.
+    // The Initialization Summary -> Component Sizing table is indexed by
+    // component name and description once per sql file.
     std::string valueNameAndUnits = valueName + std::string(" [") + units + std::string("]");
     if (units == "") {
       valueNameAndUnits = valueName;
@@ -740,37 +722,7 @@ namespace detail {
       valueNameAndUnits = valueName + std::string(" []");
     }
 
-    for (std::string rowName : rowNames.get()) {
-      std::stringstream rowCheckQuery;
-      rowCheckQuery << "SELECT Value ";
-      rowCheckQuery << "FROM tabulardatawithstrings ";
-      rowCheckQuery << "WHERE ReportName='Initialization Summary' ";
-      rowCheckQuery << "AND ReportForString='Entire Facility' ";
-      rowCheckQuery << "AND TableName = 'Component Sizing Information' ";
-      rowCheckQuery << "AND RowName='" << rowName << "' ";
-      rowCheckQuery << "AND Value='" << valueNameAndUnits << "'";
-      boost::optional<std::string> rowValueName = model().sqlFile().get().execAndReturnFirstString(rowCheckQuery.str());
-      // Check if the query succeeded
-      if (!rowValueName) {
-        continue;
-      }
-      // This is the right row
-      std::stringstream valQuery;
-      valQuery << "SELECT Value ";
-      valQuery << "FROM tabulardatawithstrings ";
-      valQuery << "WHERE ReportName='Initialization Summary' ";
-      valQuery << "AND ReportForString='Entire Facility' ";
-      valQuery << "AND TableName = 'Component Sizing Information' ";
-      valQuery << "AND ColumnName='Value' ";
-      valQuery << "AND RowName='" << rowName << "' ";
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(valQuery.str());
-      // Check if the query succeeded
-      if (val) {
-        result = val.get();
-        break;
-      }
-    }
-
+    result = model().sqlFile()->componentSizingValue(sqlName, valueNameAndUnits);
 
     if (!result) {
       LOG(Debug, "The autosized value query for " + valueNameAndUnits + " of " + sqlName + " returned no value.");
@@ -48,6 +48,7 @@
 
 #include <boost/optional.hpp>
 
+#include <map>
 #include <vector>
 
 namespace openstudio {
@@ -198,6 +199,32 @@ namespace detail {
 
     std::string plenumSpaceTypeName() const;
 
+    //@}
+    /** @name Resolved Defaults Cache */
+    //@{
+
+    /** Space resolves default constructions and schedules by walking its own default set, then its SpaceType,
+     *  BuildingStory, Building and the Building's SpaceType.  Model_Impl memoizes the result of that walk.
+     *  Cached results are cleared whenever the relationships of any Space, SpaceType, BuildingStory, Building,
+     *  DefaultConstructionSet, DefaultSurfaceConstructions, DefaultSubSurfaceConstructions or DefaultScheduleSet
+     *  change, or when one of these objects is added or removed. */
+
+    /** Get the cached default construction for space and surface key. Returns false if there is no cached
+     *  result, otherwise sets constructionHandle (null if no default construction) and searchDistance. */
+    bool cachedDefaultConstruction(const Handle& spaceHandle, const std::string& surfaceKey,
+                                   Handle& constructionHandle, int& searchDistance) const;
+
+    /** Cache the default construction for space and surface key, constructionHandle is null if there is none. */
+    void setCachedDefaultConstruction(const Handle& spaceHandle, const std::string& surfaceKey,
+                                      const Handle& constructionHandle, int searchDistance) const;
+
+    /** Get the cached default schedule for space and schedule type. Returns false if there is no cached
+     *  result, otherwise sets scheduleHandle (null if no default schedule). */
+    bool cachedDefaultSchedule(const Handle& spaceHandle, int defaultScheduleType, Handle& scheduleHandle) const;
+
+    /** Cache the default schedule for space and schedule type, scheduleHandle is null if there is none. */
+    void setCachedDefaultSchedule(const Handle& spaceHandle, int defaultScheduleType, const Handle& scheduleHandle) const;
+
     //@}
     /** @name Setters */
     //@{
@@ -303,8 +330,20 @@ namespace detail {
     mutable boost::optional<YearDescription> m_cachedYearDescription;
     mutable boost::optional<WeatherFile> m_cachedWeatherFile;
 
+    mutable std::map<std::pair<Handle, std::string>, std::pair<Handle, int> > m_cachedDefaultConstructions;
+    mutable std::map<std::pair<Handle, int>, Handle> m_cachedDefaultSchedules;
+
+    // connect signals so that resolved defaults are cleared when objects in the default set hierarchy change
+    void mf_connectResolvedDefaultsSignals(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& object);
+
+    // disconnects the signals connected by mf_connectResolvedDefaultsSignals, if any
+    void mf_disconnectResolvedDefaultsSignals(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& object);
+
   // private slots:
     void clearCachedData();
+    void clearCachedResolvedDefaults();
+    void clearCachedResolvedDefaultsOnRemove(const Handle& handle);
+    void clearCachedResolvedDefaultsOnRelationshipChange(int index, Handle newHandle, Handle oldHandle);
     void clearCachedBuilding(const Handle& handle);
     void clearCachedFoundationKivaSettings(const Handle& handle);
     void clearCachedLifeCycleCostParameters(const Handle& handle);
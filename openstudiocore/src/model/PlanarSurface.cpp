@@ -51,6 +51,7 @@
 #include "../utilities/sql/SqlFile.hpp"
 
 #include "../utilities/geometry/Geometry.hpp"
+#include "../utilities/geometry/PolygonSet.hpp"
 #include "../utilities/geometry/Transformation.hpp"
 
 #include "../utilities/core/Assert.hpp"
@@ -826,6 +827,16 @@ std::vector<SurfacePropertyConvectionCoefficients> PlanarSurface::surfacePropert
   return getImpl<detail::PlanarSurface_Impl>()->surfacePropertyConvectionCoefficients();
 }
 
+PolygonSet PlanarSurface::packVertices(const std::vector<PlanarSurface>& planarSurfaces)
+{
+  PolygonSet result;
+  result.reserve(planarSurfaces.size(), 4 * planarSurfaces.size());
+  for (const PlanarSurface& planarSurface : planarSurfaces){
+    result.addPolygon(planarSurface.vertices());
+  }
+  return result;
+}
+
 std::vector<PlanarSurface> PlanarSurface::findPlanarSurfaces(const std::vector<PlanarSurface>& planarSurfaces,
                                                              boost::optional<double> minDegreesFromNorth,
                                                              boost::optional<double> maxDegreesFromNorth,
@@ -37,6 +37,7 @@ namespace openstudio {
 
 class Plane;
 class Point3d;
+class PolygonSet;
 class Vector3d;
 
 namespace model {
@@ -133,6 +134,10 @@ class MODEL_API PlanarSurface : public ParentObject {
                                                        boost::optional<double> maxDegreesTilt,
                                                        double tol = 1);
 
+  /** Returns the vertices of planarSurfaces in local coordinates packed into a single PolygonSet,
+   *  polygon i holds the vertices of planarSurfaces[i]. */
+  static PolygonSet packVertices(const std::vector<PlanarSurface>& planarSurfaces);
+
   /** Film resistances from ASHRAE Fundamentals, Chapter 25, Table 1 for non-reflective surfaces.
    *  Units of m^2*K/W. */
   static double filmResistance(const FilmResistanceType& type);
@@ -45,6 +45,9 @@
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <unordered_map>
 
 namespace openstudio {
@@ -58,6 +61,7 @@ namespace detail {
     : ScheduleInterval_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleFile::iddObjectType());
+    this->ScheduleFile_Impl::onChange.connect<ScheduleFile_Impl, &ScheduleFile_Impl::clearCachedTimeSeries>(this);
   }
 
   ScheduleFile_Impl::ScheduleFile_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -66,13 +70,16 @@ namespace detail {
     : ScheduleInterval_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == ScheduleFile::iddObjectType());
+    this->ScheduleFile_Impl::onChange.connect<ScheduleFile_Impl, &ScheduleFile_Impl::clearCachedTimeSeries>(this);
   }
 
   ScheduleFile_Impl::ScheduleFile_Impl(const ScheduleFile_Impl& other,
                                        Model_Impl* model,
                                        bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
-  {}
+  {
+    this->ScheduleFile_Impl::onChange.connect<ScheduleFile_Impl, &ScheduleFile_Impl::clearCachedTimeSeries>(this);
+  }
 
   const std::vector<std::string>& ScheduleFile_Impl::outputVariableNames() const
   {
@@ -227,23 +234,63 @@ namespace detail {
 
   openstudio::TimeSeries ScheduleFile_Impl::timeSeries() const
   {
-    openstudio::TimeSeries result;
-    /* FIXME!
-    Date startDate(openstudio::MonthOfYear(this->startMonth()), this->startDay());
-    Time intervalLength(0, 0, this->intervalLength());
-
-    Vector values(this->numExtensibleGroups());
-    unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups())) {
-      OptionalDouble x = group.getDouble(0);
-      OS_ASSERT(x);
-      values[i] = *x;
-      ++i;
+    char separator = columnSeparatorChar();
+    int column = columnNumber();
+    int rowsToSkip = rowstoSkipatTop();
+    if ((separator == '\0') || (column < 1) || (rowsToSkip < 0)) {
+      return TimeSeries();
     }
 
-    TimeSeries result(startDate, intervalLength, values, "");
-    result.setOutOfRangeValue(this->outOfRangeValue());
-    */
+    // columns are parsed once per external file and shared by every ScheduleFile pointing to it
+    std::shared_ptr<const std::vector<Vector> > columns = externalFile().getImpl<ExternalFile_Impl>()->csvColumns(separator, rowsToSkip);
+    if (!columns) {
+      return TimeSeries();
+    }
+
+    if (m_cachedTimeSeries && (m_cachedTimeSeriesColumns.lock() == columns)) {
+      return m_cachedTimeSeries.get();
+    }
+    clearCachedTimeSeries();
+
+    if (static_cast<unsigned>(column) > columns->size()) {
+      LOG(Warn, "Column " << column << " does not exist in the external file of " << briefDescription());
+      return TimeSeries();
+    }
+
+    int minutes = 60;
+    if (boost::optional<std::string> value = minutesperItem()) {
+      minutes = std::atoi(value->c_str());
+    }
+    if ((minutes < 1) || (minutes > 60)) {
+      LOG(Warn, "Invalid Minutes per Item for " << briefDescription());
+      return TimeSeries();
+    }
+
+    int hours = 8760;
+    if (boost::optional<int> value = numberofHoursofData()) {
+      hours = value.get();
+    }
+
+    const Vector& columnValues = (*columns)[column - 1];
+    std::size_t numValues = static_cast<std::size_t>(std::max(hours, 0)) * 60 / minutes;
+    if (columnValues.size() < numValues) {
+      LOG(Warn, "Column " << column << " of the external file of " << briefDescription() << " has " << columnValues.size()
+        << " values, expected " << numValues);
+      numValues = columnValues.size();
+    }
+
+    Vector values(numValues);
+    for (std::size_t i = 0; i < numValues; ++i) {
+      if (std::isnan(columnValues[i])) {
+        LOG(Warn, "Non-numeric value in row " << rowsToSkip + i + 1 << ", column " << column << " of the external file of " << briefDescription());
+        return TimeSeries();
+      }
+      values[i] = columnValues[i];
+    }
+
+    TimeSeries result(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 0, minutes), values, "");
+    m_cachedTimeSeries = result;
+    m_cachedTimeSeriesColumns = columns;
     return result;
   }
 
@@ -330,6 +377,12 @@ namespace detail {
     return false;
   }
 
+  void ScheduleFile_Impl::clearCachedTimeSeries()
+  {
+    m_cachedTimeSeries.reset();
+    m_cachedTimeSeriesColumns.reset();
+  }
+
   void ScheduleFile_Impl::ensureNoLeapDays()
   {
     /* FIXME!
@@ -33,6 +33,10 @@
 #include "ModelAPI.hpp"
 #include "ScheduleInterval_Impl.hpp"
 
+#include "../utilities/data/TimeSeries.hpp"
+
+#include <memory>
+
 namespace openstudio {
 namespace model {
 
@@ -145,6 +149,12 @@ namespace detail {
 
    private:
      REGISTER_LOGGER("openstudio.model.ScheduleFile");
+
+     void clearCachedTimeSeries();
+
+     // the columns of the external file the cached time series was built from
+     mutable boost::optional<openstudio::TimeSeries> m_cachedTimeSeries;
+     mutable std::weak_ptr<const std::vector<Vector> > m_cachedTimeSeriesColumns;
   };
 
 } // detail
@@ -98,17 +98,7 @@ namespace detail {
     Date startDate(openstudio::MonthOfYear(this->startMonth()), this->startDay());
     Time intervalLength(0, 0, this->intervalLength());
 
-    Vector values(this->numExtensibleGroups());
-    unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
-    {
-      OptionalDouble x = group.getDouble(0);
-      OS_ASSERT(x);
-      values[i] = *x;
-      ++i;
-    }
-
-    TimeSeries result(startDate, intervalLength, values, "");
+    TimeSeries result(startDate, intervalLength, this->values(), "");
     result.setOutOfRangeValue(this->outOfRangeValue());
 
     return result;
@@ -224,6 +214,19 @@ namespace detail {
     return 0;
   }
 
+  Vector ScheduleFixedInterval_Impl::values() const {
+    // each extensible group is a single value field, read them directly instead of building a group per value
+    unsigned begin = numNonextensibleFields();
+    unsigned n = numExtensibleGroups();
+    Vector result(n);
+    for (unsigned i = 0; i < n; ++i){
+      OptionalDouble x = getDouble(begin + i);
+      OS_ASSERT(x);
+      result[i] = *x;
+    }
+    return result;
+  }
+
   double ScheduleFixedInterval_Impl::outOfRangeValue() const {
     boost::optional<double> value = getDouble(OS_Schedule_FixedIntervalFields::OutOfRangeValue,true);
     OS_ASSERT(value);
@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "ScheduleInterval_Impl.hpp"
 
+#include "../utilities/data/Vector.hpp"
+
 namespace openstudio {
 namespace model {
 
@@ -92,6 +94,10 @@ namespace detail {
 
     int startDay() const;
 
+    /** Returns the interval values packed into a single array. The extensible fields are parsed on
+     *  each call, so the array is not kept alongside the fields. */
+    Vector values() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -51,6 +51,7 @@ namespace detail {
     : ScheduleInterval_Impl(idfObject,model,keepHandle)
   {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleVariableInterval::iddObjectType());
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedTimeSeries>(this);
   }
 
   ScheduleVariableInterval_Impl::ScheduleVariableInterval_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -59,13 +60,16 @@ namespace detail {
     : ScheduleInterval_Impl(other,model,keepHandle)
   {
     OS_ASSERT(other.iddObject().type() == ScheduleVariableInterval::iddObjectType());
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedTimeSeries>(this);
   }
 
   ScheduleVariableInterval_Impl::ScheduleVariableInterval_Impl(const ScheduleVariableInterval_Impl& other,
                                                          Model_Impl* model,
                                                          bool keepHandle)
     : ScheduleInterval_Impl(other,model,keepHandle)
-  {}
+  {
+    this->ScheduleVariableInterval_Impl::onChange.connect<ScheduleVariableInterval_Impl, &ScheduleVariableInterval_Impl::clearCachedTimeSeries>(this);
+  }
 
   IddObjectType ScheduleVariableInterval_Impl::iddObjectType() const {
     return ScheduleVariableInterval::iddObjectType();
@@ -183,6 +187,13 @@ namespace detail {
 
   openstudio::TimeSeries ScheduleVariableInterval_Impl::timeSeries() const
   {
+    // TimeSeries shares its data between copies, so callers get a new one built from the cached parts
+    if (m_cachedDateTimes){
+      TimeSeries result(m_cachedDateTimes.get(), m_cachedValues.get(), "");
+      result.setOutOfRangeValue(this->outOfRangeValue());
+      return result;
+    }
+
     unsigned numExtensibleGroups = this->numExtensibleGroups();
     if (numExtensibleGroups == 0){
       return TimeSeries(Date(MonthOfYear::Jan, 1), 0, Vector(), "");
@@ -201,14 +212,17 @@ namespace detail {
     DateTimeVector dateTimes;
     dateTimes.push_back(DateTime(Date(MonthOfYear(*startMonth), *startDay), Time(0, *startHour, *startMinute)));
     Vector values(numExtensibleGroups);
-    unsigned i = 0;
-    for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
+    dateTimes.reserve(numExtensibleGroups + 1);
+    // read the fields directly rather than building an extensible group object per value
+    unsigned index = numNonextensibleFields();
+    unsigned groupSize = iddObject().extensibleGroup().size();
+    for (unsigned i = 0; i < numExtensibleGroups; ++i, index += groupSize)
     {
-      OptionalInt month = group.getInt(0);
-      OptionalInt day = group.getInt(1);
-      OptionalInt hour = group.getInt(2);
-      OptionalInt minute = group.getInt(3);
-      OptionalDouble x = group.getDouble(4);
+      OptionalInt month = getInt(index + OS_Schedule_VariableIntervalExtensibleFields::Month);
+      OptionalInt day = getInt(index + OS_Schedule_VariableIntervalExtensibleFields::Day);
+      OptionalInt hour = getInt(index + OS_Schedule_VariableIntervalExtensibleFields::Hour);
+      OptionalInt minute = getInt(index + OS_Schedule_VariableIntervalExtensibleFields::Minute);
+      OptionalDouble x = getDouble(index + OS_Schedule_VariableIntervalExtensibleFields::ValueUntilTime);
       OS_ASSERT(month);
       OS_ASSERT(day);
       OS_ASSERT(hour);
@@ -216,15 +230,22 @@ namespace detail {
       OS_ASSERT(x);
       dateTimes.push_back(DateTime(Date(MonthOfYear(*month), *day), Time(0, *hour, *minute)));
       values[i] = *x;
-      ++i;
     }
 
     TimeSeries result(dateTimes, values, "");
     result.setOutOfRangeValue(this->outOfRangeValue());
 
+    m_cachedDateTimes = dateTimes;
+    m_cachedValues = values;
     return result;
   }
 
+  void ScheduleVariableInterval_Impl::clearCachedTimeSeries()
+  {
+    m_cachedDateTimes.reset();
+    m_cachedValues.reset();
+  }
+
   bool ScheduleVariableInterval_Impl::setTimeSeries(const openstudio::TimeSeries& timeSeries)
   {
     // check the values
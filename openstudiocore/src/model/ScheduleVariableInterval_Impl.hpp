@@ -33,6 +33,8 @@
 #include "ModelAPI.hpp"
 #include "ScheduleInterval_Impl.hpp"
 
+#include "../utilities/data/TimeSeries.hpp"
+
 namespace openstudio {
 namespace model {
 
@@ -121,6 +123,12 @@ namespace detail {
    protected:
    private:
     REGISTER_LOGGER("openstudio.model.ScheduleVariableInterval");
+
+    void clearCachedTimeSeries();
+
+    mutable boost::optional<DateTimeVector> m_cachedDateTimes;
+
+    mutable boost::optional<Vector> m_cachedValues;
   };
 
 } // detail
@@ -545,7 +545,62 @@ namespace detail {
     return boost::none;
   }
 
+  // all properties of planarSurface that DefaultConstructionSet::getDefaultConstruction depends on
+  static std::string defaultConstructionSurfaceKey(const PlanarSurface& planarSurface)
+  {
+    std::string result;
+    if (boost::optional<Surface> surface = planarSurface.optionalCast<Surface>()){
+      result = "Surface|" + surface->outsideBoundaryCondition() + "|" + surface->surfaceType();
+    }else if (boost::optional<SubSurface> subSurface = planarSurface.optionalCast<SubSurface>()){
+      result = "SubSurface|";
+      if (boost::optional<Surface> surface = subSurface->surface()){
+        result += surface->outsideBoundaryCondition();
+      }
+      result += "|" + subSurface->subSurfaceType();
+    }else if (planarSurface.optionalCast<InteriorPartitionSurface>()){
+      result = "InteriorPartitionSurface";
+    }else if (boost::optional<ShadingSurface> shadingSurface = planarSurface.optionalCast<ShadingSurface>()){
+      result = "ShadingSurface|";
+      if (boost::optional<ShadingSurfaceGroup> shadingSurfaceGroup = shadingSurface->shadingSurfaceGroup()){
+        result += shadingSurfaceGroup->shadingSurfaceType();
+      }
+    }
+    return result;
+  }
+
   boost::optional<std::pair<ConstructionBase, int> > Space_Impl::getDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const
+  {
+    std::string surfaceKey = defaultConstructionSurfaceKey(planarSurface);
+    if (surfaceKey.empty()){
+      // unknown type of planar surface, let DefaultConstructionSet report the error
+      return resolveDefaultConstructionWithSearchDistance(planarSurface);
+    }
+
+    Model model = this->model();
+    std::shared_ptr<Model_Impl> modelImpl = model.getImpl<Model_Impl>();
+
+    Handle constructionHandle;
+    int searchDistance = 0;
+    if (modelImpl->cachedDefaultConstruction(this->handle(), surfaceKey, constructionHandle, searchDistance)){
+      if (constructionHandle.isNull()){
+        return boost::none;
+      }
+      boost::optional<ConstructionBase> construction = model.getModelObject<ConstructionBase>(constructionHandle);
+      if (construction){
+        return std::make_pair(*construction, searchDistance);
+      }
+    }
+
+    boost::optional<std::pair<ConstructionBase, int> > result = resolveDefaultConstructionWithSearchDistance(planarSurface);
+    if (result){
+      modelImpl->setCachedDefaultConstruction(this->handle(), surfaceKey, result->first.handle(), result->second);
+    }else{
+      modelImpl->setCachedDefaultConstruction(this->handle(), surfaceKey, Handle(), 0);
+    }
+    return result;
+  }
+
+  boost::optional<std::pair<ConstructionBase, int> > Space_Impl::resolveDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const
   {
     boost::optional<ConstructionBase> result;
     boost::optional<DefaultConstructionSet> defaultConstructionSet;
@@ -629,6 +684,31 @@ namespace detail {
   }
 
   boost::optional<Schedule> Space_Impl::getDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const
+  {
+    Model model = this->model();
+    std::shared_ptr<Model_Impl> modelImpl = model.getImpl<Model_Impl>();
+
+    Handle scheduleHandle;
+    if (modelImpl->cachedDefaultSchedule(this->handle(), defaultScheduleType.value(), scheduleHandle)){
+      if (scheduleHandle.isNull()){
+        return boost::none;
+      }
+      boost::optional<Schedule> schedule = model.getModelObject<Schedule>(scheduleHandle);
+      if (schedule){
+        return schedule;
+      }
+    }
+
+    boost::optional<Schedule> result = resolveDefaultSchedule(defaultScheduleType);
+    if (result){
+      modelImpl->setCachedDefaultSchedule(this->handle(), defaultScheduleType.value(), result->handle());
+    }else{
+      modelImpl->setCachedDefaultSchedule(this->handle(), defaultScheduleType.value(), Handle());
+    }
+    return result;
+  }
+
+  boost::optional<Schedule> Space_Impl::resolveDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const
   {
     boost::optional<Schedule> result;
     boost::optional<DefaultScheduleSet> defaultScheduleSet;
@@ -487,6 +487,10 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.model.Space");
 
+    // walk the default set hierarchy, results are memoized by Model_Impl
+    boost::optional<std::pair<ConstructionBase, int> > resolveDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const;
+    boost::optional<Schedule> resolveDefaultSchedule(const DefaultScheduleType& defaultScheduleType) const;
+
     openstudio::Quantity directionofRelativeNorth_SI() const;
     openstudio::Quantity directionofRelativeNorth_IP() const;
     bool setDirectionofRelativeNorth(const Quantity& directionofRelativeNorth);
@@ -49,6 +49,10 @@
 #include "../ShadingSurface.hpp"
 #include "../ShadingSurfaceGroup.hpp"
 #include "../Space.hpp"
+#include "../SpaceType.hpp"
+#include "../BuildingStory.hpp"
+#include "../Building.hpp"
+#include "../Building_Impl.hpp"
 
 #include "../../utilities/geometry/Point3d.hpp"
 
@@ -557,3 +561,100 @@ TEST_F(ModelFixture, DefaultConstructionSet_CloneBadName)
   clone = defaultSurfaceConstructions.clone(model);
   EXPECT_EQ("*H.a.r.d.e.s.t*^\\1|-|8/_#($name$)?# 2", clone.name().get());
 }
+
+TEST_F(ModelFixture, DefaultConstructionSet_ResolvedDefaultsCache)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0,1,0));
+  points.push_back(Point3d(0,0,0));
+  points.push_back(Point3d(1,0,0));
+  Surface surface(points, model);
+  EXPECT_TRUE(surface.setOutsideBoundaryCondition("Outdoors"));
+  EXPECT_TRUE(surface.setSurfaceType("Wall"));
+
+  Space space(model);
+  EXPECT_TRUE(surface.setSpace(space));
+
+  Construction wall1(model);
+  Construction wall2(model);
+  Construction floor(model);
+
+  DefaultSurfaceConstructions defaultSurfaceConstructions1(model);
+  EXPECT_TRUE(defaultSurfaceConstructions1.setWallConstruction(wall1));
+  EXPECT_TRUE(defaultSurfaceConstructions1.setFloorConstruction(floor));
+  DefaultConstructionSet defaultConstructionSet1(model);
+  EXPECT_TRUE(defaultConstructionSet1.setDefaultExteriorSurfaceConstructions(defaultSurfaceConstructions1));
+
+  DefaultSurfaceConstructions defaultSurfaceConstructions2(model);
+  EXPECT_TRUE(defaultSurfaceConstructions2.setWallConstruction(wall2));
+  DefaultConstructionSet defaultConstructionSet2(model);
+  EXPECT_TRUE(defaultConstructionSet2.setDefaultExteriorSurfaceConstructions(defaultSurfaceConstructions2));
+
+  // nothing to resolve, repeated calls return the cached result
+  EXPECT_FALSE(surface.construction());
+  EXPECT_FALSE(surface.construction());
+
+  // building level set
+  Building building = model.getUniqueModelObject<Building>();
+  EXPECT_TRUE(building.setDefaultConstructionSet(defaultConstructionSet2));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall2.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(4, surface.constructionWithSearchDistance()->second);
+
+  // building story set
+  BuildingStory buildingStory(model);
+  EXPECT_TRUE(space.setBuildingStory(buildingStory));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(wall2.handle(), surface.construction()->handle());
+  EXPECT_TRUE(buildingStory.setDefaultConstructionSet(defaultConstructionSet1));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall1.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(3, surface.constructionWithSearchDistance()->second);
+
+  // space type set
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+  EXPECT_TRUE(spaceType.setDefaultConstructionSet(defaultConstructionSet2));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall2.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(2, surface.constructionWithSearchDistance()->second);
+
+  // changes to the surface itself are picked up
+  EXPECT_TRUE(surface.setSurfaceType("Floor"));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(floor.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(3, surface.constructionWithSearchDistance()->second);
+  EXPECT_TRUE(surface.setSurfaceType("Wall"));
+
+  // changes to the set contents are picked up
+  EXPECT_TRUE(defaultSurfaceConstructions2.setWallConstruction(wall1));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(wall1.handle(), surface.construction()->handle());
+  EXPECT_TRUE(defaultSurfaceConstructions2.setWallConstruction(wall2));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(wall2.handle(), surface.construction()->handle());
+
+  // space set
+  EXPECT_TRUE(space.setDefaultConstructionSet(defaultConstructionSet1));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall1.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(1, surface.constructionWithSearchDistance()->second);
+
+  // removing objects in the hierarchy is picked up
+  wall1.remove();
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall2.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(2, surface.constructionWithSearchDistance()->second);
+
+  spaceType.remove();
+  building.remove();
+  EXPECT_FALSE(surface.construction());
+
+  // hard assigned construction
+  EXPECT_TRUE(surface.setConstruction(wall2));
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(wall2.handle(), surface.constructionWithSearchDistance()->first.handle());
+  EXPECT_EQ(0, surface.constructionWithSearchDistance()->second);
+}
@@ -39,6 +39,10 @@
 #include "../ScheduleConstant_Impl.hpp"
 #include "../ScheduleTypeLimits.hpp"
 #include "../ScheduleCompact.hpp"
+#include "../Space.hpp"
+#include "../SpaceType.hpp"
+#include "../Building.hpp"
+#include "../Building_Impl.hpp"
 
 #include <utilities/idd/OS_DefaultScheduleSet_FieldEnums.hxx>
 
@@ -173,3 +177,40 @@ TEST_F(ModelFixture, DefaultScheduleSet_ScheduleTypes) {
   EXPECT_TRUE(scheduleSet.setPointer(OS_DefaultScheduleSetFields::HoursofOperationScheduleName,alwaysOn.handle()));
   EXPECT_TRUE(scheduleSet.hoursofOperationSchedule());
 }
+
+TEST_F(ModelFixture, DefaultScheduleSet_ResolvedDefaultsCache)
+{
+  Model model;
+
+  Space space(model);
+  ScheduleConstant schedule1(model);
+  ScheduleConstant schedule2(model);
+
+  DefaultScheduleSet defaultScheduleSet1(model);
+  EXPECT_TRUE(defaultScheduleSet1.setLightingSchedule(schedule1));
+  DefaultScheduleSet defaultScheduleSet2(model);
+  EXPECT_TRUE(defaultScheduleSet2.setLightingSchedule(schedule2));
+
+  // nothing to resolve, repeated calls return the cached result
+  EXPECT_FALSE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+  EXPECT_FALSE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+
+  Building building = model.getUniqueModelObject<Building>();
+  EXPECT_TRUE(building.setDefaultScheduleSet(defaultScheduleSet1));
+  ASSERT_TRUE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+  EXPECT_EQ(schedule1.handle(), space.getDefaultSchedule(DefaultScheduleType::LightingSchedule)->handle());
+  EXPECT_FALSE(space.getDefaultSchedule(DefaultScheduleType::NumberofPeopleSchedule));
+
+  SpaceType spaceType(model);
+  EXPECT_TRUE(space.setSpaceType(spaceType));
+  EXPECT_TRUE(spaceType.setDefaultScheduleSet(defaultScheduleSet2));
+  ASSERT_TRUE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+  EXPECT_EQ(schedule2.handle(), space.getDefaultSchedule(DefaultScheduleType::LightingSchedule)->handle());
+
+  EXPECT_TRUE(defaultScheduleSet2.setLightingSchedule(schedule1));
+  ASSERT_TRUE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+  EXPECT_EQ(schedule1.handle(), space.getDefaultSchedule(DefaultScheduleType::LightingSchedule)->handle());
+
+  schedule1.remove();
+  EXPECT_FALSE(space.getDefaultSchedule(DefaultScheduleType::LightingSchedule));
+}
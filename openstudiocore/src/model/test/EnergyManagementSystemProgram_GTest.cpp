@@ -329,3 +329,35 @@ TEST_F(ModelFixture, EMSProgramUid_EMSProgramUid) {
   EXPECT_EQ(true, (fan_program_1.referencedObjects()[2].nameString() == fanName) || (fan_program_1.referencedObjects()[2].nameString() == "OATdb_Sensor"));
 }
 
+
+TEST_F(ModelFixture, EMSProgram_CachedProgramLines) {
+  Model model;
+
+  OutputVariable siteOutdoorAirDrybulbTemperature("Site Outdoor Air Drybulb Temperature", model);
+  EnergyManagementSystemSensor OATdbSensor(model, siteOutdoorAirDrybulbTemperature);
+  OATdbSensor.setName("OATdb Sensor");
+
+  EnergyManagementSystemProgram program(model);
+  EXPECT_EQ(0, program.lines().size());
+  EXPECT_EQ(0, program.referencedObjects().size());
+
+  //cached lines are rebuilt after the body changes
+  program.setBody("SET mult = " + toString(OATdbSensor.handle()) + " / 15.0");
+  EXPECT_EQ(1, program.lines().size());
+  ASSERT_EQ(1, program.referencedObjects().size());
+  EXPECT_EQ(OATdbSensor.handle(), program.referencedObjects()[0].handle());
+
+  program.addLine("SET mult2 = " + toString(OATdbSensor.handle()) + " * " + toString(OATdbSensor.handle()));
+  EXPECT_EQ(2, program.lines().size());
+  EXPECT_EQ(3, program.referencedObjects().size());
+  EXPECT_EQ(0, program.invalidReferencedObjects().size());
+
+  //removing the referenced object invalidates both lines
+  OATdbSensor.remove();
+  EXPECT_EQ(0, program.referencedObjects().size());
+  EXPECT_EQ(2, program.invalidReferencedObjects().size());
+
+  program.resetBody();
+  EXPECT_EQ(0, program.lines().size());
+  EXPECT_EQ(0, program.invalidReferencedObjects().size());
+}
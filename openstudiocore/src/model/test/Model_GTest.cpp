@@ -86,6 +86,8 @@
 
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include <sstream>
+
 using namespace openstudio::model;
 using namespace openstudio;
 /*
@@ -511,6 +513,57 @@ TEST_F(ModelFixture, ExampleModel_ReloadTwoTimes)
   }
 }
 
+TEST_F(ModelFixture, ExampleModel_Snapshot)
+{
+  Model model = exampleModel();
+
+  openstudio::path path = toPath("./ExampleModel_Snapshot.osm");
+  openstudio::path snapshotPath = IdfFile::snapshotPath(path);
+  EXPECT_TRUE(model.save(path, true));
+  EXPECT_TRUE(model.saveSnapshot(snapshotPath, true));
+  EXPECT_FALSE(model.saveSnapshot(snapshotPath, false));
+
+  // snapshot prints exactly like the osm
+  boost::optional<IdfFile> snapshot = IdfFile::loadSnapshot(snapshotPath);
+  ASSERT_TRUE(snapshot);
+  EXPECT_EQ(IddFileType(IddFileType::OpenStudio), snapshot->iddFileType());
+  std::stringstream expected, actual;
+  model.toIdfFile().print(expected);
+  snapshot->print(actual);
+  EXPECT_EQ(expected.str(), actual.str());
+
+  // osm text is not a snapshot
+  EXPECT_FALSE(IdfFile::loadSnapshot(path));
+  EXPECT_TRUE(IdfFile::loadCurrentSnapshot(path, IddFileType::OpenStudio));
+  EXPECT_FALSE(IdfFile::loadCurrentSnapshot(path, IddFileType::EnergyPlus));
+
+  boost::optional<Model> model2 = Model::load(path);
+  ASSERT_TRUE(model2);
+  ASSERT_EQ(model.numObjects(), model2->numObjects());
+  ThermalZoneVector zones = model2->getModelObjects<ThermalZone>();
+  ASSERT_FALSE(zones.empty());
+  EXPECT_FALSE(zones[0].spaces().empty());
+
+  std::vector<WorkspaceObject> objects = model.objects();
+  std::vector<WorkspaceObject> objects2 = model2->objects();
+  for (unsigned i = 0; i < objects.size(); ++i){
+    EXPECT_EQ(objects[i].handle(), objects2[i].handle());
+  }
+
+  // an osm changed after the snapshot was saved no longer matches it, whatever its write time
+  {
+    openstudio::filesystem::ofstream ofs(path, std::ios_base::app);
+    ofs << "! changed after the snapshot was saved" << std::endl;
+  }
+  EXPECT_FALSE(IdfFile::loadCurrentSnapshot(path, IddFileType::OpenStudio));
+  model2 = Model::load(path);
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(model.numObjects(), model2->numObjects());
+
+  openstudio::filesystem::remove(path);
+  openstudio::filesystem::remove(snapshotPath);
+}
+
 
 TEST_F(ModelFixture, Model_building) {
   Model model;
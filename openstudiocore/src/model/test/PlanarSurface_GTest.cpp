@@ -32,6 +32,10 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Surface.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/PolygonSet.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
@@ -87,3 +91,34 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions)
   EXPECT_NEAR(qc->value(),PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph),1.0E-8);
 }
 
+
+TEST_F(ModelFixture, PlanarSurface_PackVertices)
+{
+  Model model;
+
+  std::vector<Point3d> vertices1;
+  vertices1.push_back(Point3d(0, 0, 1));
+  vertices1.push_back(Point3d(0, 0, 0));
+  vertices1.push_back(Point3d(1, 0, 0));
+  vertices1.push_back(Point3d(1, 0, 1));
+  Surface surface1(vertices1, model);
+
+  std::vector<Point3d> vertices2;
+  vertices2.push_back(Point3d(0, 1, 0));
+  vertices2.push_back(Point3d(1, 1, 0));
+  vertices2.push_back(Point3d(1, 0, 0));
+  Surface surface2(vertices2, model);
+
+  std::vector<PlanarSurface> planarSurfaces;
+  planarSurfaces.push_back(surface1);
+  planarSurfaces.push_back(surface2);
+
+  PolygonSet polygonSet = PlanarSurface::packVertices(planarSurfaces);
+  ASSERT_EQ(2u, polygonSet.numPolygons());
+  EXPECT_EQ(7u, polygonSet.numVertices());
+  EXPECT_EQ(surface1.vertices(), polygonSet.vertices(0));
+  EXPECT_EQ(surface2.vertices(), polygonSet.vertices(1));
+  ASSERT_EQ(7u, polygonSet.xs().size());
+  EXPECT_DOUBLE_EQ(1.0, polygonSet.zs()[0]);
+  EXPECT_DOUBLE_EQ(1.0, polygonSet.ys()[4]);
+}
@@ -145,6 +145,10 @@ TEST_F(ModelFixture, Schedule_VariableInterval)
   EXPECT_FALSE(timeSeries3.intervalLength());
   EXPECT_EQ(timeSeries2.values().size(), timeSeries3.values().size());
 
+  // changing a returned time series does not change the schedule
+  timeSeries3.setOutOfRangeValue(schedule.outOfRangeValue() + 1.0);
+  EXPECT_EQ(schedule.outOfRangeValue(), schedule.timeSeries().outOfRangeValue());
+
   boost::optional<ScheduleInterval> newSchedule = ScheduleInterval::fromTimeSeries(timeSeries3, model);
   ASSERT_TRUE(newSchedule);
   EXPECT_NE(schedule.handle(), newSchedule->handle());
@@ -362,3 +366,48 @@ TEST_F(ModelFixture, ScheduleFile)
   EXPECT_FALSE(exists(filePath));
 
 }
+
+TEST_F(ModelFixture, ScheduleFile_TimeSeries)
+{
+  Model model;
+
+  path p = resourcesPath() / toPath("model/schedulefile.csv");
+  EXPECT_TRUE(exists(p));
+
+  boost::optional<ExternalFile> externalfile = ExternalFile::getExternalFile(model, openstudio::toString(p));
+  ASSERT_TRUE(externalfile);
+
+  ScheduleFile schedule(*externalfile, 2, 1);
+  TimeSeries timeSeries = schedule.timeSeries();
+  ASSERT_EQ(8760u, timeSeries.values().size());
+  EXPECT_DOUBLE_EQ(8759.0, timeSeries.values()[0]);
+  EXPECT_DOUBLE_EQ(0.0, timeSeries.values()[8759]);
+  ASSERT_TRUE(timeSeries.intervalLength());
+  EXPECT_DOUBLE_EQ(60.0, timeSeries.intervalLength()->totalMinutes());
+
+  // both schedules share the columns parsed from the file
+  ScheduleFile schedule2(*externalfile, 3, 1);
+  std::shared_ptr<const std::vector<Vector> > columns = externalfile->getImpl<detail::ExternalFile_Impl>()->csvColumns(',', 1);
+  ASSERT_TRUE(columns);
+  EXPECT_EQ(3u, columns->size());
+  EXPECT_EQ(8760u, schedule2.timeSeries().values().size());
+  EXPECT_DOUBLE_EQ(0.207618053, schedule2.timeSeries().values()[0]);
+  EXPECT_EQ(columns, externalfile->getImpl<detail::ExternalFile_Impl>()->csvColumns(',', 1));
+
+  // the cached series is rebuilt when the schedule changes
+  EXPECT_TRUE(schedule.setMinutesperItem("30"));
+  timeSeries = schedule.timeSeries();
+  ASSERT_EQ(8760u, timeSeries.values().size());
+  ASSERT_TRUE(timeSeries.intervalLength());
+  EXPECT_DOUBLE_EQ(30.0, timeSeries.intervalLength()->totalMinutes());
+
+  EXPECT_TRUE(schedule.setColumnNumber(10));
+  EXPECT_EQ(0u, schedule.timeSeries().values().size());
+
+  // header row is not numeric
+  EXPECT_TRUE(schedule.setColumnNumber(2));
+  EXPECT_TRUE(schedule.setRowstoSkipatTop(0));
+  EXPECT_EQ(0u, schedule.timeSeries().values().size());
+
+  externalfile->remove();
+}
@@ -3,6 +3,10 @@
 
 #include "nano_function.hpp"
 
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
 namespace Nano
 {
 
@@ -11,80 +15,261 @@ class Observer
 
     template <typename T> friend class Signal;
 
-    struct DelegateKeyObserver { DelegateKey delegate; Observer* observer; };
-    struct SSNode { DelegateKeyObserver data; SSNode* next; } *head = nullptr;
+    // A connection is linked into the list of the signal that emits it and, if the slot belongs
+    // to an Observer, into that Observer's list as well, so either side can unlink it in O(1)
+    struct Connection
+    {
+        DelegateKey delegate;
+        Observer* signal;
+        Observer* observer; // nullptr for free functions and functors
+        Connection* prevInSignal;
+        Connection* nextInSignal;
+        Connection* prevInObserver;
+        Connection* nextInObserver;
+        bool alive;
+    };
+
+    struct DelegateKeyHash
+    {
+        std::size_t operator()(DelegateKey const& key) const
+        {
+            std::size_t seed = std::hash<std::uintptr_t>()(key[0]);
+            return seed ^ (std::hash<std::uintptr_t>()(key[1]) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+        }
+    };
+
+    using ConnectionIndex = std::unordered_multimap<DelegateKey, Connection*, DelegateKeyHash>;
+
+    // Signals with at most this many connections find them by scanning the list, most signals
+    // only ever have one or two and the index would cost more memory than the connections
+    static const unsigned indexThreshold = 8;
+
+    Connection* signalHead = nullptr;   // connections emitted by this, when this is a Signal
+    Connection* observerHead = nullptr; // connections to slots of this
+    // live signal connections by key, only allocated once there are more than indexThreshold
+    std::unique_ptr<ConnectionIndex> index;
+    unsigned numConnections = 0;        // live signal connections
+    unsigned emitDepth = 0;             // nested emissions in progress
+    bool hasDead = false;               // connections removed during emission, freed when it ends
 
     //-----------------------------------------------------------PRIVATE METHODS
 
     void insert(DelegateKey const& key, Observer* obs)
     {
-        head = new SSNode { { key, obs }, head };
+        // New connections go to the front, which keeps the emission order of the original list
+        auto node = new Connection { key, this, obs, nullptr, signalHead, nullptr, nullptr, true };
+        if (signalHead)
+        {
+            signalHead->prevInSignal = node;
+        }
+        signalHead = node;
+
+        if (obs)
+        {
+            node->nextInObserver = obs->observerHead;
+            if (obs->observerHead)
+            {
+                obs->observerHead->prevInObserver = node;
+            }
+            obs->observerHead = node;
+        }
+
+        ++numConnections;
+        if (index)
+        {
+            index->emplace(key, node);
+        }
+        else if (numConnections > indexThreshold)
+        {
+            index.reset(new ConnectionIndex);
+            for (auto it = signalHead; it; it = it->nextInSignal)
+            {
+                if (it->alive)
+                {
+                    index->emplace(it->delegate, it);
+                }
+            }
+        }
     }
 
     void remove(DelegateKey const& key, Observer* obs)
     {
-        SSNode* node = head;
-        SSNode* prev = nullptr;
         // Only delete the first occurrence
-        for ( ; node; prev = node, node = node->next)
+        if (index)
         {
-            if (node->data.delegate == key && node->data.observer == obs)
+            auto range = index->equal_range(key);
+            for (auto it = range.first; it != range.second; ++it)
             {
-                if (prev)
+                if (it->second->observer == obs)
                 {
-                    prev->next = node->next;
+                    Connection* node = it->second;
+                    index->erase(it);
+                    disconnect(node);
+                    break;
                 }
-                else
-                {
-                    head = head->next;
-                }
-                delete node;
+            }
+            return;
+        }
+        for (auto node = signalHead; node; node = node->nextInSignal)
+        {
+            if (node->alive && node->observer == obs && node->delegate == key)
+            {
+                disconnect(node);
+                break;
+            }
+        }
+    }
+
+    // Unlinks a connection from both sides. The connection must already be removed from the
+    // signal's index, if it has one.
+    static void disconnect(Connection* node)
+    {
+        if (Observer* obs = node->observer)
+        {
+            if (node->prevInObserver)
+            {
+                node->prevInObserver->nextInObserver = node->nextInObserver;
+            }
+            else
+            {
+                obs->observerHead = node->nextInObserver;
+            }
+            if (node->nextInObserver)
+            {
+                node->nextInObserver->prevInObserver = node->prevInObserver;
+            }
+            node->observer = nullptr;
+        }
+
+        Observer* signal = node->signal;
+        --signal->numConnections;
+        if (signal->emitDepth > 0)
+        {
+            // The emitting loop may be holding this node, so leave it in place until it finishes
+            node->alive = false;
+            signal->hasDead = true;
+            return;
+        }
+        unlinkFromSignal(node);
+        delete node;
+    }
+
+    static void unlinkFromSignal(Connection* node)
+    {
+        Observer* signal = node->signal;
+        if (node->prevInSignal)
+        {
+            node->prevInSignal->nextInSignal = node->nextInSignal;
+        }
+        else
+        {
+            signal->signalHead = node->nextInSignal;
+        }
+        if (node->nextInSignal)
+        {
+            node->nextInSignal->prevInSignal = node->prevInSignal;
+        }
+    }
+
+    static void eraseFromIndex(Connection* node)
+    {
+        if (!node->signal->index)
+        {
+            return;
+        }
+        auto range = node->signal->index->equal_range(node->delegate);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == node)
+            {
+                node->signal->index->erase(it);
                 break;
             }
         }
     }
 
+    void removeDead()
+    {
+        for (auto node = signalHead; node;)
+        {
+            auto next = node->nextInSignal;
+            if (!node->alive)
+            {
+                unlinkFromSignal(node);
+                delete node;
+            }
+            node = next;
+        }
+        hasDead = false;
+    }
+
     void removeAll()
     {
-        for (auto node = head; node;)
+        // Slots of this that are connected to other signals
+        while (observerHead)
         {
-            auto temp = node;
-            // If this is us we only need to delete
-            if (this != node->data.observer)
+            Connection* node = observerHead;
+            eraseFromIndex(node);
+            disconnect(node);
+        }
+
+        // Slots connected to this signal
+        index.reset();
+        for (auto node = signalHead; node;)
+        {
+            auto next = node->nextInSignal;
+            if (node->alive)
             {
-                // Remove this slot from this listening Observer
-                node->data.observer->remove(node->data.delegate, this);
+                disconnect(node);
             }
-            node = node->next;
-            delete temp;
+            node = next;
         }
-        head = nullptr;
     }
 
     bool ss_isEmpty() const
     {
-        return head == nullptr;
+        return numConnections == 0;
     }
 
+    // Keeps removed connections alive until the outermost emission returns, including by exception
+    struct EmitGuard
+    {
+        Observer& signal;
+        explicit EmitGuard(Observer& s) : signal(s) { ++signal.emitDepth; }
+        ~EmitGuard()
+        {
+            if (--signal.emitDepth == 0 && signal.hasDead)
+            {
+                signal.removeDead();
+            }
+        }
+    };
+
     template <typename Delegate, typename... Uref>
     void onEach(Uref&&... args)
     {
-        for (auto node = head, next = head; node; node = next)
+        EmitGuard guard(*this);
+        for (auto node = signalHead; node; node = node->nextInSignal)
         {
-            next = node->next;
-            // Perfect forward and emit
-            Delegate(node->data.delegate)(std::forward<Uref>(args)...);
+            if (node->alive)
+            {
+                // Perfect forward and emit
+                Delegate(node->delegate)(std::forward<Uref>(args)...);
+            }
         }
     }
 
     template <typename Delegate, typename Accumulate, typename... Uref>
     void onEach_Accumulate(Accumulate&& accumulate, Uref&&... args)
     {
-        for (auto node = head, next = head; node; node = next)
+        EmitGuard guard(*this);
+        for (auto node = signalHead; node; node = node->nextInSignal)
         {
-            next = node->next;
-            // Perfect forward, emit, and accumulate the return value
-            accumulate(Delegate(node->data.delegate)(std::forward<Uref>(args)...));
+            if (node->alive)
+            {
+                // Perfect forward, emit, and accumulate the return value
+                accumulate(Delegate(node->delegate)(std::forward<Uref>(args)...));
+            }
         }
     }
 
@@ -95,6 +280,10 @@ class Observer
     ~Observer()
     {
         removeAll();
+        if (hasDead)
+        {
+            removeDead();
+        }
     }
 
     //--------------------------------------------------------------------PUBLIC
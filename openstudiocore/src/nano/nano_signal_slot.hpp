@@ -15,23 +15,21 @@ class Signal<RT(Args...)> : private Observer
     void insert_sfinae(DelegateKey const& key, typename T::Observer* instance)
     {
         Observer::insert(key, instance);
-        instance->insert(key, this);
     }
     template <typename T>
     void remove_sfinae(DelegateKey const& key, typename T::Observer* instance)
     {
         Observer::remove(key, instance);
-        instance->remove(key, this);
     }
     template <typename T>
     void insert_sfinae(DelegateKey const& key, ...)
     {
-        Observer::insert(key, this);
+        Observer::insert(key, nullptr);
     }
     template <typename T>
     void remove_sfinae(DelegateKey const& key, ...)
     {
-        Observer::remove(key, this);
+        Observer::remove(key, nullptr);
     }
 
     public:
@@ -43,7 +41,7 @@ class Signal<RT(Args...)> : private Observer
     template <typename L>
     void connect(L* instance)
     {
-        Observer::insert(Delegate::template bind (instance), this);
+        Observer::insert(Delegate::template bind (instance), nullptr);
     }
     template <typename L>
     void connect(L& instance)
@@ -54,7 +52,7 @@ class Signal<RT(Args...)> : private Observer
     template <RT (* fun_ptr)(Args...)>
     void connect()
     {
-        Observer::insert(Delegate::template bind<fun_ptr>(), this);
+        Observer::insert(Delegate::template bind<fun_ptr>(), nullptr);
     }
 
     template <typename T, RT (T::* mem_ptr)(Args...)>
@@ -84,7 +82,7 @@ class Signal<RT(Args...)> : private Observer
     template <typename L>
     void disconnect(L* instance)
     {
-        Observer::remove(Delegate::template bind (instance), this);
+        Observer::remove(Delegate::template bind (instance), nullptr);
     }
     template <typename L>
     void disconnect(L& instance)
@@ -95,7 +93,7 @@ class Signal<RT(Args...)> : private Observer
     template <RT (* fun_ptr)(Args...)>
     void disconnect()
     {
-        Observer::remove(Delegate::template bind<fun_ptr>(), this);
+        Observer::remove(Delegate::template bind<fun_ptr>(), nullptr);
     }
 
     template <typename T, RT (T::* mem_ptr)(Args...)>
@@ -99,6 +99,7 @@
 #include "../model/ZoneHVACWaterToAirHeatPump.hpp"
 
 #include "../osversion/VersionTranslator.hpp"
+#include "../osversion/ComponentLibraryCache.hpp"
 
 #include "../energyplus/ForwardTranslator.hpp"
 #include "../energyplus/ReverseTranslator.hpp"
@@ -121,6 +122,7 @@
 #include <QTimer>
 #include <QWidget>
 #include <QProcess>
+#include <QStandardPaths>
 #include <QTcpServer>
 #include <QtConcurrent>
 #include <QtGlobal>
@@ -136,7 +138,10 @@ namespace openstudio {
 
 OpenStudioApp::OpenStudioApp( int & argc, char ** argv)
   : OSAppBase(argc, argv, QSharedPointer<MeasureManager>(new MeasureManager(this))),
-    m_measureManagerProcess(nullptr)
+    m_measureManagerProcess(nullptr),
+    m_openFileRestoreTabs(false),
+    m_openFileFromCommandLine(false),
+    m_pendingOpenFileRestoreTabs(false)
 {
   setOrganizationName("NREL");
   QCoreApplication::setOrganizationDomain("nrel.gov");
@@ -198,6 +203,11 @@ OpenStudioApp::OpenStudioApp( int & argc, char ** argv)
   auto buildCompLibrariesFuture = QtConcurrent::run(this,&OpenStudioApp::buildCompLibraries);
   m_buildCompLibWatcher.setFuture(buildCompLibrariesFuture);
   connect(&m_buildCompLibWatcher, &QFutureWatcher<std::vector<std::string> >::finished, this, &OpenStudioApp::onMeasureManagerAndLibraryReady);
+
+  connect(this, &OpenStudioApp::openFileProgressed, this, &OpenStudioApp::onOpenFileProgressed, Qt::QueuedConnection);
+  connect(waitDialog().get(), &WaitDialog::cancelButtonClicked, this, &OpenStudioApp::cancelOpenFile);
+  connect(&m_openFileWatcher, &QFutureWatcher<boost::optional<model::Model> >::finished, this, &OpenStudioApp::onOpenFileLoaded);
+  connect(&m_openFileWatcher, &QFutureWatcher<boost::optional<model::Model> >::finished, this, &OpenStudioApp::openPendingFile);
 }
 
 OpenStudioApp::~OpenStudioApp()
@@ -225,38 +235,8 @@ void OpenStudioApp::onMeasureManagerAndLibraryReady() {
       QFileInfo info(args.at(0)); // handles windows links and "\"
       QString fileName = info.absoluteFilePath();
 
-      osversion::VersionTranslator versionTranslator;
-      versionTranslator.setAllowNewerVersions(false);
-
-      boost::optional<openstudio::model::Model> model = versionTranslator.loadModel(toPath(fileName));
-      if( model ){
-
-        m_osDocument = std::shared_ptr<OSDocument>( new OSDocument(componentLibrary(),
-                                                                   resourcesPath(),
-                                                                   model,
-                                                                   fileName) );
-
-        connectOSDocumentSignals();
-
-        if(args.size() == 2){
-          // check for 'noSavePath'
-          if (args.at(1) == QString("noSavePath")){
-            m_osDocument->setSavePath("");
-            QTimer::singleShot(0, m_osDocument.get(), SLOT(markAsModified()));
-          }else{
-            LOG_FREE(Warn, "OpenStudio", "Incorrect second argument '" << toString(args.at(1)) << "'");
-          }
-        }
-
-        openedCommandLine = true;
-
-        versionUpdateMessageBox(versionTranslator, true, fileName, openstudio::toPath(m_osDocument->modelTempDir()));
-
-      }else{
-        LOG_FREE(Warn, "OpenStudio", "Could not open file at " << toString(fileName));
-
-        versionUpdateMessageBox(versionTranslator, false, fileName, openstudio::path());
-      }
+      // onOpenFileLoaded creates an empty model if this fails
+      openedCommandLine = openFile(fileName, false, true);
 
     }else if(args.size() > 2){
       LOG_FREE(Warn, "OpenStudio", "Incorrect number of arguments " << args.size());
@@ -268,68 +248,164 @@ void OpenStudioApp::onMeasureManagerAndLibraryReady() {
   }
 }
 
-bool OpenStudioApp::openFile(const QString& fileName, bool restoreTabs)
+bool OpenStudioApp::openFile(const QString& fileName, bool restoreTabs, bool fromCommandLine)
 {
   // Note: already checked for in open() before calling this
-  if(fileName.length() > 0)
-  {
-    osversion::VersionTranslator versionTranslator;
-    versionTranslator.setAllowNewerVersions(false);
+  if (fileName.length() == 0) {
+    return false;
+  }
 
-    boost::optional<openstudio::model::Model> temp = versionTranslator.loadModel(toPath(fileName));
-    // If VT worked
-    if (temp) {
-      model::Model model = temp.get();
+  if (m_openFileWatcher.isRunning()) {
+    // opened by openPendingFile once the current file has loaded, a later request replaces this one
+    LOG_FREE(Info, "OpenStudio", "Opening file at " << toString(fileName) << " after " << toString(m_openFileName) << " has loaded");
+    m_pendingOpenFileName = fileName;
+    m_pendingOpenFileRestoreTabs = restoreTabs;
+    waitDialog()->m_fourthLine->setText(QString("%1\nNext: %2").arg(m_openFileName).arg(fileName));
+    return true;
+  }
 
-      bool wasQuitOnLastWindowClosed = this->quitOnLastWindowClosed();
-      this->setQuitOnLastWindowClosed(false);
+  m_openFileTranslator = std::make_shared<osversion::VersionTranslator>();
+  m_openFileTranslator->setAllowNewerVersions(false);
+  m_openFileTranslator->setProgressCallback([this](const std::string& description, int stage, int numStages) {
+    // called on the worker thread, the connection to onOpenFileProgressed is queued
+    emit openFileProgressed(toQString(description), stage, numStages);
+  });
+  m_openFileName = fileName;
+  m_openFileRestoreTabs = restoreTabs;
+  m_openFileFromCommandLine = fromCommandLine;
 
-      int startTabIndex = 0;
-      int startSubTabIndex = 0;
-      if( m_osDocument ){
+  waitDialog()->resetLabels();
+  waitDialog()->m_fourthLine->setText(fileName);
+  waitDialog()->cancelButton()->setEnabled(true);
+  waitDialog()->cancelButton()->show();
+  waitDialog()->setVisible(true);
+
+  // Reading, version translation and building the workspace all happen off the GUI thread,
+  // only the OSDocument is constructed here once loading has finished
+  std::shared_ptr<osversion::VersionTranslator> versionTranslator = m_openFileTranslator;
+  openstudio::path path = toPath(fileName);
+  m_openFileWatcher.setFuture(QtConcurrent::run([versionTranslator, path]() {
+    return versionTranslator->loadModel(path);
+  }));
 
-        if (restoreTabs){
-          startTabIndex = m_osDocument->verticalTabIndex();
-          startSubTabIndex = m_osDocument->subTabIndex();
-        }
+  return true;
+}
 
-        if( !closeDocument() ) {
-          this->setQuitOnLastWindowClosed(wasQuitOnLastWindowClosed);
-          return false;
-        }
-        processEvents();
-      }
+void OpenStudioApp::onOpenFileProgressed(const QString& description, int stage, int numStages)
+{
+  if (m_openFileTranslator && !m_openFileTranslator->isCancelled()) {
+    waitDialog()->m_thirdLine->setText(QString("%1 (%2 of %3)").arg(description).arg(stage).arg(numStages));
+  }
+}
 
-      // TODO: waitDialog isn't showed until VT has actually happened and worked?
-      // I tried to show it visible in the begining of the method, but it isn't displayed correctly:
-      // transparent + hidden by Filedialog which isn't closed yet.
-      waitDialog()->setVisible(true);
-      processEvents();
+void OpenStudioApp::cancelOpenFile()
+{
+  if (m_openFileTranslator && m_openFileWatcher.isRunning()) {
+    // best effort, loading stops at the next check between steps and onOpenFileLoaded then cleans up,
+    // files queued behind this one are not opened
+    m_openFileTranslator->cancel();
+    m_pendingOpenFileName.clear();
+    waitDialog()->m_thirdLine->setText("Cancelling...");
+    waitDialog()->cancelButton()->setEnabled(false);
+  }
+}
 
-      m_osDocument = std::shared_ptr<OSDocument>( new OSDocument(componentLibrary(),
-                                                                 resourcesPath(),
-                                                                 model,
-                                                                 fileName,
-                                                                 false,
-                                                                 startTabIndex,
-                                                                 startSubTabIndex) );
+void OpenStudioApp::onOpenFileLoaded()
+{
+  std::shared_ptr<osversion::VersionTranslator> versionTranslator = m_openFileTranslator;
+  m_openFileTranslator.reset();
+  OS_ASSERT(versionTranslator);
 
-      connectOSDocumentSignals();
+  QString fileName = m_openFileName;
+  boost::optional<openstudio::model::Model> temp = m_openFileWatcher.result();
 
-      waitDialog()->setVisible(false);
+  waitDialog()->cancelButton()->hide();
 
-      versionUpdateMessageBox(versionTranslator, true, fileName, openstudio::toPath(m_osDocument->modelTempDir()));
+  if (!temp) {
+    waitDialog()->setVisible(false);
+    waitDialog()->resetLabels();
 
+    if (versionTranslator->isCancelled()) {
+      LOG_FREE(Info, "OpenStudio", "Cancelled opening file at " << toString(fileName));
+    } else {
+      LOG_FREE(Warn, "OpenStudio", "Could not open file at " << toString(fileName));
+
+      versionUpdateMessageBox(*versionTranslator, false, fileName, openstudio::path());
+    }
+
+    if (m_openFileFromCommandLine) {
+      newFromEmptyTemplateSlot();
+    }
+    return;
+  }
+
+  model::Model model = temp.get();
+
+  bool wasQuitOnLastWindowClosed = this->quitOnLastWindowClosed();
+  this->setQuitOnLastWindowClosed(false);
+
+  int startTabIndex = 0;
+  int startSubTabIndex = 0;
+  if( m_osDocument ){
+
+    if (m_openFileRestoreTabs){
+      startTabIndex = m_osDocument->verticalTabIndex();
+      startSubTabIndex = m_osDocument->subTabIndex();
+    }
+
+    if( !closeDocument() ) {
+      waitDialog()->setVisible(false);
+      waitDialog()->resetLabels();
       this->setQuitOnLastWindowClosed(wasQuitOnLastWindowClosed);
+      return;
+    }
+    processEvents();
+  }
 
-      return true;
-    }else{
-      LOG_FREE(Warn, "OpenStudio", "Could not open file at " << toString(fileName));
+  waitDialog()->m_thirdLine->setText("Building the user interface");
+  processEvents();
+
+  // OSDocument only builds the tab that is shown, the others are built when first selected
+  m_osDocument = std::shared_ptr<OSDocument>( new OSDocument(componentLibrary(),
+                                                             resourcesPath(),
+                                                             model,
+                                                             fileName,
+                                                             false,
+                                                             startTabIndex,
+                                                             startSubTabIndex) );
+
+  connectOSDocumentSignals();
 
-      versionUpdateMessageBox(versionTranslator, false, fileName, openstudio::path());
+  if (m_openFileFromCommandLine) {
+    QStringList args = QApplication::arguments();
+    args.removeFirst(); // application name
+    if(args.size() == 2){
+      // check for 'noSavePath'
+      if (args.at(1) == QString("noSavePath")){
+        m_osDocument->setSavePath("");
+        QTimer::singleShot(0, m_osDocument.get(), SLOT(markAsModified()));
+      }else{
+        LOG_FREE(Warn, "OpenStudio", "Incorrect second argument '" << toString(args.at(1)) << "'");
+      }
     }
   }
-  return false;
+
+  waitDialog()->setVisible(false);
+  waitDialog()->resetLabels();
+
+  versionUpdateMessageBox(*versionTranslator, true, fileName, openstudio::toPath(m_osDocument->modelTempDir()));
+
+  this->setQuitOnLastWindowClosed(wasQuitOnLastWindowClosed);
+}
+
+void OpenStudioApp::openPendingFile()
+{
+  if (m_pendingOpenFileName.isEmpty()) {
+    return;
+  }
+  QString fileName = m_pendingOpenFileName;
+  m_pendingOpenFileName.clear();
+  openFile(fileName, m_pendingOpenFileRestoreTabs);
 }
 
 std::vector<std::string> OpenStudioApp::buildCompLibraries()
@@ -356,22 +432,27 @@ std::vector<std::string> OpenStudioApp::buildCompLibraries()
 
   std::string thisVersion = openStudioVersion();
 
+  // translated libraries are cached by checksum, so only new or changed libraries are translated
+  osversion::ComponentLibraryCache cache(toPath(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)) / toPath("libraries"));
+
   for( auto path : libraryPaths() ) {
     try {
       if ( exists(path) ) {
-        boost::optional<VersionString> version = openstudio::IdfFile::loadVersionOnly(path);
-        if (version) {
-          waitDialog()->m_thirdLine->setText(QString::fromStdString("Translation From version " + version->str()
-                                          + " to " + thisVersion + ": "));
+        if (cache.isCached(path)) {
+          waitDialog()->m_thirdLine->setText("Loading cached library: ");
         } else {
-          waitDialog()->m_thirdLine->setText("Unknown starting version");
+          boost::optional<VersionString> version = openstudio::IdfFile::loadVersionOnly(path);
+          if (version) {
+            waitDialog()->m_thirdLine->setText(QString::fromStdString("Translation From version " + version->str()
+                                            + " to " + thisVersion + ": "));
+          } else {
+            waitDialog()->m_thirdLine->setText("Unknown starting version");
+          }
         }
 
         waitDialog()->m_fourthLine->setText(toQString(path));
 
-        osversion::VersionTranslator versionTranslator;
-        versionTranslator.setAllowNewerVersions(false);
-        boost::optional<Model> temp = versionTranslator.loadModel(path);
+        boost::optional<Model> temp = cache.loadLibrary(path);
         if (temp) {
           m_compLibrary.insertObjects(temp->objects());
         } else {
@@ -808,9 +889,6 @@ void OpenStudioApp::open()
   setLastPath(QFileInfo(fileName).path());
 
   openFile(fileName);
-
-  // Reset the labels
-  waitDialog()->resetLabels();
 }
 
 //void OpenStudioApp::loadLibrary()
@@ -61,6 +61,9 @@
 #include <QProcess>
 #include <QFutureWatcher>
 
+#include <boost/optional.hpp>
+
+#include <memory>
 #include <vector>
 #include <map>
 
@@ -119,6 +122,9 @@ class OpenStudioApp : public OSAppBase
 
  signals:
 
+  // Emitted from the worker thread as each stage of opening a model begins
+  void openFileProgressed(const QString& description, int stage, int numStages);
+
  public slots:
 
   void quit();
@@ -190,6 +196,17 @@ class OpenStudioApp : public OSAppBase
 
   void onChangeDefaultLibrariesDone();
 
+  void onOpenFileProgressed(const QString& description, int stage, int numStages);
+
+  // Asks the model currently being opened to stop loading
+  void cancelOpenFile();
+
+  // Second half of openFile, called when the worker thread has finished loading
+  void onOpenFileLoaded();
+
+  // Opens the file requested while another one was loading, called after onOpenFileLoaded
+  void openPendingFile();
+
  private:
 
   enum fileType{
@@ -201,7 +218,9 @@ class OpenStudioApp : public OSAppBase
 
   void import(fileType type);
 
-  bool openFile(const QString& fileName, bool restoreTabs = false);
+  // Starts loading the model on a worker thread, if a model is already being opened this one is
+  // opened after it
+  bool openFile(const QString& fileName, bool restoreTabs = false, bool fromCommandLine = false);
 
   void versionUpdateMessageBox(const osversion::VersionTranslator& translator, bool successful, const QString& fileName,
       const openstudio::path &tempModelDir);
@@ -243,6 +262,16 @@ class OpenStudioApp : public OSAppBase
   QFutureWatcher<std::vector<std::string> > m_buildCompLibWatcher;
   QFutureWatcher<void> m_waitForMeasureManagerWatcher;
   QFutureWatcher<std::vector<std::string> > m_changeLibrariesWatcher;
+
+  // State of the model being opened by openFile
+  QFutureWatcher<boost::optional<openstudio::model::Model> > m_openFileWatcher;
+  std::shared_ptr<osversion::VersionTranslator> m_openFileTranslator;
+  QString m_openFileName;
+  bool m_openFileRestoreTabs;
+  bool m_openFileFromCommandLine;
+  // File requested while another one was being opened
+  QString m_pendingOpenFileName;
+  bool m_pendingOpenFileRestoreTabs;
 };
 
 } // openstudio
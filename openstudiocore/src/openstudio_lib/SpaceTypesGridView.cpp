@@ -1609,27 +1609,32 @@ namespace openstudio {
           int columnCount = this->columnCount();
           for( int i = 1; i < this->rowCount(); ++i ) {
             if( this->modelObject(i).handle() == t_spaceType->handle() ) {
+              // Rows that are not loaded yet have no widgets, they get the new choices when they are loaded
               // Standards Building Type is penultimate
               QWidget * t_widgetStandardsBuildingType = this->cell(i, columnCount - 2);
               // 0 appears to be GridLayout, 1 is a Holder
-              QObject * oBT = t_widgetStandardsBuildingType->children()[1];
-              Holder * holderBT = qobject_cast<Holder *>(oBT);
-              if( holderBT ) {
-                OSComboBox2 * comboBoxBuildingType = qobject_cast<OSComboBox2 *>( holderBT->widget );
-                if( comboBoxBuildingType ) {
-                  comboBoxBuildingType->onChoicesRefreshTrigger();
+              if( t_widgetStandardsBuildingType && (t_widgetStandardsBuildingType->children().size() > 1) ) {
+                QObject * oBT = t_widgetStandardsBuildingType->children()[1];
+                Holder * holderBT = qobject_cast<Holder *>(oBT);
+                if( holderBT ) {
+                  OSComboBox2 * comboBoxBuildingType = qobject_cast<OSComboBox2 *>( holderBT->widget );
+                  if( comboBoxBuildingType ) {
+                    comboBoxBuildingType->onChoicesRefreshTrigger();
+                  }
                 }
               }
 
               // Standards Space Type is last
               QWidget * t_widgetStandardsSpaceType = this->cell(i, columnCount - 1);
               // 0 appears to be GridLayout, 1 is a Holder
-              QObject * oST = t_widgetStandardsSpaceType->children()[1];
-              Holder * holderST = qobject_cast<Holder *>(oST);
-              if( holderST ) {
-                OSComboBox2 * comboBoxSpaceType = qobject_cast<OSComboBox2 *>( holderST->widget );
-                if( comboBoxSpaceType ) {
-                  comboBoxSpaceType->onChoicesRefreshTrigger();
+              if( t_widgetStandardsSpaceType && (t_widgetStandardsSpaceType->children().size() > 1) ) {
+                QObject * oST = t_widgetStandardsSpaceType->children()[1];
+                Holder * holderST = qobject_cast<Holder *>(oST);
+                if( holderST ) {
+                  OSComboBox2 * comboBoxSpaceType = qobject_cast<OSComboBox2 *>( holderST->widget );
+                  if( comboBoxSpaceType ) {
+                    comboBoxSpaceType->onChoicesRefreshTrigger();
+                  }
                 }
               }
               break;
@@ -1692,14 +1697,17 @@ namespace openstudio {
           int columnCount = this->columnCount();
           for( int i = 1; i < this->rowCount(); ++i ) {
             if( this->modelObject(i).handle() == t_spaceType->handle() ) {
+              // Rows that are not loaded yet have no widgets, they get the new choices when they are loaded
               QWidget * t_widgetStandardsSpaceType = this->cell(i, columnCount - 1);
               // 0 appears to be GridLayout, 1 is a Holder
-              QObject * oST = t_widgetStandardsSpaceType->children()[1];
-              Holder * holderST = qobject_cast<Holder *>(oST);
-              if( holderST ) {
-                OSComboBox2 * comboBoxSpaceType = qobject_cast<OSComboBox2 *>( holderST->widget );
-                if( comboBoxSpaceType ) {
-                  comboBoxSpaceType->onChoicesRefreshTrigger();
+              if( t_widgetStandardsSpaceType && (t_widgetStandardsSpaceType->children().size() > 1) ) {
+                QObject * oST = t_widgetStandardsSpaceType->children()[1];
+                Holder * holderST = qobject_cast<Holder *>(oST);
+                if( holderST ) {
+                  OSComboBox2 * comboBoxSpaceType = qobject_cast<OSComboBox2 *>( holderST->widget );
+                  if( comboBoxSpaceType ) {
+                    comboBoxSpaceType->onChoicesRefreshTrigger();
+                  }
                 }
               }
               break;
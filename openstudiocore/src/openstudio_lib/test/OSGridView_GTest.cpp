@@ -0,0 +1,93 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "OpenStudioLibFixture.hpp"
+
+#include "../FacilityStoriesGridView.hpp"
+
+#include "../../shared_gui_components/OSGridController.hpp"
+#include "../../shared_gui_components/OSGridView.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/BuildingStory.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <QApplication>
+#include <QScrollArea>
+
+using namespace openstudio;
+
+TEST_F(OpenStudioLibFixture, OSGridView_LoadRows)
+{
+  model::Model model;
+  std::vector<model::ModelObject> modelObjects;
+  for (int i = 0; i < 250; ++i) {
+    modelObjects.push_back(model::BuildingStory(model));
+  }
+
+  // without a scroll area every row is loaded
+  {
+    auto gridController = new FacilityStoriesGridController(true, "Building Stories", IddObjectType::OS_BuildingStory, model, modelObjects);
+    OSGridView gridView(gridController, "Building Stories", "Drop\nStory", false);
+    gridView.refreshAll();
+    int rowCount = gridController->rowCount();
+    ASSERT_GT(rowCount, 200);
+    EXPECT_TRUE(gridController->cell(rowCount - 1, 0));
+  }
+
+  // in a scroll area rows are loaded a page at a time
+  QScrollArea scrollArea;
+  scrollArea.setWidgetResizable(true);
+  auto gridController = new FacilityStoriesGridController(true, "Building Stories", IddObjectType::OS_BuildingStory, model, modelObjects);
+  auto gridView = new OSGridView(gridController, "Building Stories", "Drop\nStory", false);
+  scrollArea.setWidget(gridView);
+  scrollArea.show();
+  QApplication::processEvents();
+
+  int rowCount = gridController->rowCount();
+  EXPECT_TRUE(gridController->cell(99, 0));
+  EXPECT_FALSE(gridController->cell(150, 0));
+  EXPECT_FALSE(gridView->itemAtPosition(150, 0));
+
+  gridView->loadRows(151);
+  EXPECT_TRUE(gridController->cell(150, 0));
+  EXPECT_FALSE(gridController->cell(rowCount - 1, 0));
+
+  gridView->loadAllRows();
+  EXPECT_TRUE(gridController->cell(rowCount - 1, 0));
+  QApplication::processEvents();
+
+  // scrolled to the top, a refresh only loads the first page again
+  gridView->refreshAll();
+  EXPECT_TRUE(gridController->cell(99, 0));
+  EXPECT_FALSE(gridController->cell(rowCount - 1, 0));
+}
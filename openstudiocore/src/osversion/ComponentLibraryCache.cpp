@@ -0,0 +1,285 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ComponentLibraryCache.hpp"
+#include "VersionTranslator.hpp"
+
+#include "../model/ModelObject.hpp"
+
+#include "../utilities/idf/IdfFile.hpp"
+#include "../utilities/idd/IddObject.hpp"
+#include "../utilities/idd/IddField.hpp"
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/Compare.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <OpenStudio.hxx>
+
+namespace openstudio {
+namespace osversion {
+
+ComponentLibraryCache::ComponentLibraryCache(const openstudio::path& cacheDirectory)
+  : m_cacheDirectory(cacheDirectory)
+{}
+
+openstudio::path ComponentLibraryCache::cacheDirectory() const {
+  return m_cacheDirectory;
+}
+
+openstudio::path ComponentLibraryCache::cachePath(const openstudio::path& libraryPath) const {
+  // the checksum is of the file contents, and the version keeps other builds of OpenStudio from
+  // reading this build's snapshots and indices
+  return m_cacheDirectory / toPath(toString(libraryPath.stem()) + "-" + openStudioLongVersion() + "-" +
+                                   openstudio::checksum(libraryPath) + ".snapshot");
+}
+
+openstudio::path ComponentLibraryCache::indexPath(const openstudio::path& snapshot) const {
+  openstudio::path result = snapshot;
+  result.replace_extension(toPath("index"));
+  return result;
+}
+
+bool ComponentLibraryCache::isCached(const openstudio::path& libraryPath) const {
+  if (!openstudio::filesystem::is_regular_file(libraryPath)) {
+    return false;
+  }
+  return isCachedSnapshot(cachePath(libraryPath));
+}
+
+bool ComponentLibraryCache::isCachedSnapshot(const openstudio::path& snapshot) const {
+  return openstudio::filesystem::exists(snapshot) && openstudio::filesystem::exists(indexPath(snapshot));
+}
+
+bool ComponentLibraryCache::writeCache(const openstudio::path& snapshot, model::Model library) {
+  try {
+    openstudio::filesystem::create_directories(m_cacheDirectory);
+  } catch (const std::exception&) {
+    LOG(Warn, "Unable to create component library cache directory '" << toString(m_cacheDirectory) << "'");
+    return false;
+  }
+
+  // write the index first, a snapshot without an index is not considered cached
+  openstudio::path p = indexPath(snapshot);
+  openstudio::filesystem::ofstream os(p, std::ios_base::binary | std::ios_base::trunc);
+  if (!os) {
+    LOG(Warn, "Unable to write component library index '" << toString(p) << "'");
+    return false;
+  }
+  std::vector<LibraryObjectSummary> summaries;
+  for (const model::ModelObject& object : library.getModelObjects<model::ModelObject>()) {
+    LibraryObjectSummary summary;
+    summary.iddObjectType = object.iddObject().type();
+    summary.handle = object.handle();
+    summary.name = object.nameString();
+    IddObject iddObject = object.iddObject();
+    for (unsigned i = 0, n = object.numFields(); i < n; ++i) {
+      boost::optional<IddField> field = iddObject.getField(i);
+      if (field && boost::istarts_with(field->name(), "Standards")) {
+        boost::optional<std::string> value = object.getString(i, false, true);
+        if (value && !value->empty()) {
+          summary.standardsTags.push_back(*value);
+        }
+      }
+    }
+    // one tab separated line per object: type, handle, name, standards tags
+    os << summary.iddObjectType.valueName() << '\t' << toString(summary.handle) << '\t' << summary.name;
+    for (const std::string& tag : summary.standardsTags) {
+      os << '\t' << tag;
+    }
+    os << '\n';
+    summaries.push_back(summary);
+  }
+  os.close();
+  if (!os) {
+    LOG(Warn, "Unable to write component library index '" << toString(p) << "'");
+    return false;
+  }
+
+  if (!library.saveSnapshot(snapshot, true)) {
+    LOG(Warn, "Unable to write component library snapshot '" << toString(snapshot) << "'");
+    openstudio::filesystem::remove(p);
+    return false;
+  }
+  m_indices[snapshot] = summaries;
+  return true;
+}
+
+std::vector<LibraryObjectSummary> ComponentLibraryCache::readIndex(const openstudio::path& p) const {
+  std::vector<LibraryObjectSummary> result;
+  openstudio::filesystem::ifstream is(p, std::ios_base::binary);
+  std::string line;
+  while (std::getline(is, line)) {
+    std::vector<std::string> columns;
+    boost::split(columns, line, boost::is_any_of("\t"));
+    if (columns.size() < 3) {
+      continue;
+    }
+    try {
+      LibraryObjectSummary summary;
+      summary.iddObjectType = IddObjectType(columns[0]);
+      summary.handle = toUUID(columns[1]);
+      summary.name = columns[2];
+      summary.standardsTags.assign(columns.begin() + 3, columns.end());
+      result.push_back(summary);
+    } catch (const std::exception&) {
+      LOG(Warn, "Skipping malformed line in component library index '" << toString(p) << "'");
+    }
+  }
+  return result;
+}
+
+boost::optional<model::Model> ComponentLibraryCache::loadLibrary(const openstudio::path& libraryPath) {
+  if (!openstudio::filesystem::is_regular_file(libraryPath)) {
+    LOG(Error, "Component library '" << toString(libraryPath) << "' does not exist");
+    return boost::none;
+  }
+
+  openstudio::path snapshot = cachePath(libraryPath);
+  auto it = m_loaded.find(snapshot);
+  if (it != m_loaded.end()) {
+    return it->second;
+  }
+
+  boost::optional<model::Model> result;
+  if (isCachedSnapshot(snapshot)) {
+    boost::optional<IdfFile> idfFile = IdfFile::loadSnapshot(snapshot);
+    if (idfFile) {
+      try {
+        result = model::Model(*idfFile);
+      } catch (const std::exception&) {
+        LOG(Warn, "Unable to load component library snapshot '" << toString(snapshot) << "', rebuilding it");
+      }
+    }
+  }
+
+  if (!result) {
+    VersionTranslator versionTranslator;
+    versionTranslator.setAllowNewerVersions(false);
+    result = versionTranslator.loadModel(libraryPath);
+    if (!result) {
+      LOG(Error, "Failed to load component library '" << toString(libraryPath) << "'");
+      return boost::none;
+    }
+    writeCache(snapshot, *result);
+  }
+
+  m_loaded.insert(std::make_pair(snapshot, *result));
+  return result;
+}
+
+std::vector<LibraryObjectSummary> ComponentLibraryCache::index(const openstudio::path& libraryPath) {
+  if (!openstudio::filesystem::is_regular_file(libraryPath)) {
+    LOG(Error, "Component library '" << toString(libraryPath) << "' does not exist");
+    return std::vector<LibraryObjectSummary>();
+  }
+
+  openstudio::path snapshot = cachePath(libraryPath);
+  auto it = m_indices.find(snapshot);
+  if (it != m_indices.end()) {
+    return it->second;
+  }
+  if (!isCachedSnapshot(snapshot)) {
+    // builds the cache, and the index along with it
+    loadLibrary(libraryPath);
+    it = m_indices.find(snapshot);
+    if (it != m_indices.end()) {
+      return it->second;
+    }
+    if (!isCachedSnapshot(snapshot)) {
+      return std::vector<LibraryObjectSummary>();
+    }
+  }
+  std::vector<LibraryObjectSummary> result = readIndex(indexPath(snapshot));
+  m_indices[snapshot] = result;
+  return result;
+}
+
+std::vector<LibraryObjectSummary> ComponentLibraryCache::find(const openstudio::path& libraryPath,
+                                                              const IddObjectType& iddObjectType)
+{
+  std::vector<LibraryObjectSummary> result;
+  for (const LibraryObjectSummary& summary : index(libraryPath)) {
+    if (summary.iddObjectType == iddObjectType) {
+      result.push_back(summary);
+    }
+  }
+  return result;
+}
+
+std::vector<LibraryObjectSummary> ComponentLibraryCache::find(const openstudio::path& libraryPath,
+                                                              const IddObjectType& iddObjectType,
+                                                              const std::string& name)
+{
+  std::vector<LibraryObjectSummary> result;
+  for (const LibraryObjectSummary& summary : index(libraryPath)) {
+    if ((summary.iddObjectType == iddObjectType) && istringEqual(summary.name, name)) {
+      result.push_back(summary);
+    }
+  }
+  return result;
+}
+
+std::vector<LibraryObjectSummary> ComponentLibraryCache::findByStandardsTag(const openstudio::path& libraryPath,
+                                                                            const std::string& tag)
+{
+  std::vector<LibraryObjectSummary> result;
+  for (const LibraryObjectSummary& summary : index(libraryPath)) {
+    for (const std::string& standardsTag : summary.standardsTags) {
+      if (istringEqual(standardsTag, tag)) {
+        result.push_back(summary);
+        break;
+      }
+    }
+  }
+  return result;
+}
+
+boost::optional<model::Component> ComponentLibraryCache::loadComponent(const openstudio::path& libraryPath,
+                                                                       const Handle& handle)
+{
+  boost::optional<model::Model> library = loadLibrary(libraryPath);
+  if (!library) {
+    return boost::none;
+  }
+  boost::optional<model::ModelObject> object = library->getModelObject<model::ModelObject>(handle);
+  if (!object) {
+    LOG(Warn, "Component library '" << toString(libraryPath) << "' has no object with handle " << toString(handle));
+    return boost::none;
+  }
+  return object->createComponent();
+}
+
+void ComponentLibraryCache::clearLoaded() {
+  m_loaded.clear();
+}
+
+} // osversion
+} // openstudio
@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef OSVERSION_COMPONENTLIBRARYCACHE_HPP
+#define OSVERSION_COMPONENTLIBRARYCACHE_HPP
+
+#include "OSVersionAPI.hpp"
+
+#include "../model/Model.hpp"
+#include "../model/Component.hpp"
+
+#include "../utilities/core/Path.hpp"
+#include "../utilities/core/UUID.hpp"
+#include "../utilities/core/Logger.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <map>
+
+namespace openstudio {
+namespace osversion {
+
+/** Summary of one object in a cached component library, available without loading the library. */
+struct OSVERSION_API LibraryObjectSummary {
+  IddObjectType iddObjectType;
+  Handle handle;
+  std::string name;
+  /** Values of the object's Standards fields, for instance standards building and space types. */
+  std::vector<std::string> standardsTags;
+};
+
+/** ComponentLibraryCache keeps version translated copies of component libraries (such as the
+ *  HVAC and construction libraries loaded by the OpenStudio Application) in a cache directory, so
+ *  that they can be loaded without version translating and parsing the osm each time. Each
+ *  library is stored as a binary snapshot (see IdfFile::saveSnapshot) named after the OpenStudio
+ *  version and the checksum of the library file, so editing or replacing the library, or
+ *  upgrading OpenStudio, invalidates its cache. Alongside the snapshot is a small index of object
+ *  types, names and standards tags that can be searched without loading the library at all.
+ *
+ *  Libraries that have been loaded are held in memory by the cache, so pulling several
+ *  components from the same library only loads it once. */
+class OSVERSION_API ComponentLibraryCache {
+ public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  /** Creates a cache in cacheDirectory, which is created when the first library is cached. */
+  explicit ComponentLibraryCache(const openstudio::path& cacheDirectory);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  openstudio::path cacheDirectory() const;
+
+  /** Returns the path of the snapshot for the current contents of the library at libraryPath. */
+  openstudio::path cachePath(const openstudio::path& libraryPath) const;
+
+  /** Returns true if the library at libraryPath has a current cache. */
+  bool isCached(const openstudio::path& libraryPath) const;
+
+  //@}
+  /** @name Actions */
+  //@{
+
+  /** Returns the library at libraryPath, loading it from the cache if it is current, and version
+   *  translating it and writing the cache otherwise. The returned model is shared with this cache,
+   *  clone it before making changes. */
+  boost::optional<model::Model> loadLibrary(const openstudio::path& libraryPath);
+
+  /** Returns the index of the library at libraryPath, building the cache if needed. */
+  std::vector<LibraryObjectSummary> index(const openstudio::path& libraryPath);
+
+  /** Returns the index entries of type iddObjectType. */
+  std::vector<LibraryObjectSummary> find(const openstudio::path& libraryPath, const IddObjectType& iddObjectType);
+
+  /** Returns the index entries of type iddObjectType whose name is name (case insensitive). */
+  std::vector<LibraryObjectSummary> find(const openstudio::path& libraryPath, const IddObjectType& iddObjectType,
+                                         const std::string& name);
+
+  /** Returns the index entries with a standards tag equal to tag (case insensitive). */
+  std::vector<LibraryObjectSummary> findByStandardsTag(const openstudio::path& libraryPath, const std::string& tag);
+
+  /** Returns the object with handle in the library at libraryPath, together with the objects it
+   *  depends on, as a Component. */
+  boost::optional<model::Component> loadComponent(const openstudio::path& libraryPath, const Handle& handle);
+
+  /** Releases libraries held in memory. The cache files are kept. */
+  void clearLoaded();
+
+  //@}
+ private:
+  REGISTER_LOGGER("openstudio.osversion.ComponentLibraryCache");
+
+  openstudio::path indexPath(const openstudio::path& snapshot) const;
+  bool isCachedSnapshot(const openstudio::path& snapshot) const;
+  bool writeCache(const openstudio::path& snapshot, model::Model library);
+  std::vector<LibraryObjectSummary> readIndex(const openstudio::path& p) const;
+
+  openstudio::path m_cacheDirectory;
+  // loaded libraries and parsed indices keyed by cache path
+  std::map<openstudio::path, model::Model> m_loaded;
+  std::map<openstudio::path, std::vector<LibraryObjectSummary> > m_indices;
+};
+
+} // osversion
+} // openstudio
+
+#endif // OSVERSION_COMPONENTLIBRARYCACHE_HPP
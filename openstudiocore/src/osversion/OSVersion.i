@@ -23,6 +23,7 @@
 
 %{
   #include <osversion/VersionTranslator.hpp>
+  #include <osversion/ComponentLibraryCache.hpp>
 
   #include <model/Model.hpp>
   #include <model/Component.hpp>
@@ -32,7 +33,12 @@
   using namespace openstudio::osversion;
 %}
 
+// boost::function is not wrapped
+%ignore openstudio::osversion::VersionTranslator::setProgressCallback;
 %include <osversion/VersionTranslator.hpp>
 
+%template(LibraryObjectSummaryVector) std::vector<openstudio::osversion::LibraryObjectSummary>;
+%include <osversion/ComponentLibraryCache.hpp>
+
 #endif // OSVERSION_I
 
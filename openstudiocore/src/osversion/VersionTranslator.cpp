@@ -74,7 +74,8 @@ namespace osversion {
 
 VersionTranslator::VersionTranslator()
   : m_originalVersion("0.0.0"),
-    m_allowNewerVersions(true)
+    m_allowNewerVersions(true),
+    m_cancelled(false)
 {
   m_logSink.setLogLevel(Warn);
   m_logSink.setChannelRegex(boost::regex("openstudio\\.osversion\\.VersionTranslator"));
@@ -386,6 +387,33 @@ void VersionTranslator::setAllowNewerVersions(bool allowNewerVersions)
   m_allowNewerVersions = allowNewerVersions;
 }
 
+void VersionTranslator::setProgressCallback(const boost::function<void (const std::string&, int, int)>& callback)
+{
+  m_progressCallback = callback;
+}
+
+void VersionTranslator::cancel()
+{
+  m_cancelled = true;
+}
+
+bool VersionTranslator::isCancelled() const
+{
+  return m_cancelled;
+}
+
+bool VersionTranslator::beginStage(const std::string& description, int stage, int numStages)
+{
+  if (m_cancelled) {
+    LOG(Info,"Translation cancelled before stage '" << description << "'.");
+    return false;
+  }
+  if (m_progressCallback) {
+    m_progressCallback(description, stage, numStages);
+  }
+  return true;
+}
+
 boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
                                                                bool isComponent,
                                                                ProgressBar* progressBar) {
@@ -402,6 +430,13 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   m_nObjectsFinalModel = 0;
   m_isComponent = isComponent;
 
+  // reading, one stage per start version, then workspace, validity and model construction
+  int numStages = m_startVersions.size() + 4;
+  int stage = 0;
+
+  if (!beginStage("Reading file", ++stage, numStages)) {
+    return boost::none;
+  }
   initializeMap(is);
   OS_ASSERT(m_map.size() < 2u);
   if (m_map.size() == 0u) {
@@ -417,6 +452,12 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
       progressBar->setWindowTitle("Upgrading from " + startVersion.str());
       progressBar->setValue(progressBar->value()+1);
     }
+    ++stage;
+    if (m_map.find(startVersion) != m_map.end()) {
+      if (!beginStage("Upgrading from " + startVersion.str(), stage, numStages)) {
+        return boost::none;
+      }
+    }
     update(startVersion); // does nothing if no map entry
   }
   if (progressBar){
@@ -440,12 +481,22 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   }
 
   // validity checking
+  if (!beginStage("Building workspace", ++stage, numStages)) {
+    return boost::none;
+  }
   Workspace finalWorkspace(finalModel);
+  // steps within a stage cannot be interrupted, but cancellation is checked between them
+  if (m_cancelled) {
+    return boost::none;
+  }
   model::Model tempModel(finalWorkspace); // None-level strictness!
   OS_ASSERT(tempModel.strictnessLevel() == StrictnessLevel::None);
   std::vector<std::shared_ptr<InterobjectIssueInformation> > issueInfo = fixInterobjectIssuesStage1(
       tempModel,
       m_originalVersion);
+  if (!beginStage("Checking validity", ++stage, numStages)) {
+    return boost::none;
+  }
   if (!tempModel.isValid(StrictnessLevel::Draft)) {
     LOG(Error,"Model with Version " << openStudioVersion() << " IDD is not valid to draft "
         << "strictness level.");
@@ -456,15 +507,22 @@ boost::optional<model::Model> VersionTranslator::updateVersion(std::istream& is,
   OS_ASSERT(test);
   fixInterobjectIssuesStage2(tempModel,issueInfo);
 
+  if (!beginStage(isComponent ? "Building component" : "Building model", ++stage, numStages)) {
+    return boost::none;
+  }
+  IdfFile finalIdfFile = tempModel.toIdfFile();
+  if (m_cancelled) {
+    return boost::none;
+  }
   if (isComponent) {
     try {
-      result = model::Component(tempModel.toIdfFile()); // includes name conflict fixes
+      result = model::Component(finalIdfFile); // includes name conflict fixes
     }
     catch (std::exception& e) {
       LOG(Error,"Could not translate component, because " << e.what());
     }
   } else {
-    result = model::Model(tempModel.toIdfFile()); // includes name conflict fixes
+    result = model::Model(finalIdfFile); // includes name conflict fixes
   }
 
   if (result) {
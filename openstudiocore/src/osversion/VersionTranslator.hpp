@@ -44,6 +44,7 @@
 
 #include <boost/functional.hpp>
 
+#include <atomic>
 #include <map>
 
 namespace openstudio {
@@ -158,6 +159,27 @@ class OSVERSION_API VersionTranslator {
   /** Set whether or not loading newer versions is allowed. */
   void setAllowNewerVersions(bool allowNewerVersions);
 
+  //@}
+  /** @name Progress and Cancellation
+   *
+   *  Support running loadModel or loadComponent on a worker thread. */
+  //@{
+
+  /** Set a function to be called as each stage of translation begins, with a description of the
+   *  stage, the stage number, and the total number of stages. The function is called on the
+   *  thread doing the translation. */
+  void setProgressCallback(const boost::function<void (const std::string&, int, int)>& callback);
+
+  /** Asks a translation in progress, possibly on another thread, to stop, in which case loadModel
+   *  or loadComponent returns boost::none. Cancellation is best effort: it is checked between
+   *  stages and between the steps of a stage, but constructing a Workspace or Model is not
+   *  interrupted, so a large file may keep loading for a while after this call. A cancelled
+   *  translator stays cancelled; use a new VersionTranslator for the next file. */
+  void cancel();
+
+  /** Returns true if cancel has been called. */
+  bool isCancelled() const;
+
   //@}
  private:
   REGISTER_LOGGER("openstudio.osversion.VersionTranslator");
@@ -168,6 +190,8 @@ class OSVERSION_API VersionTranslator {
 
   VersionString m_originalVersion;
   bool m_allowNewerVersions;
+  boost::function<void (const std::string&, int, int)> m_progressCallback;
+  std::atomic<bool> m_cancelled;
   std::map<VersionString, IdfFile> m_map;
   StringStreamLogSink m_logSink;
   std::vector<IdfObject> m_deprecated, m_untranslated, m_new;
@@ -184,6 +208,9 @@ class OSVERSION_API VersionTranslator {
 
   void initializeMap(std::istream& is);
 
+  // reports the stage and returns false if the translation has been cancelled
+  bool beginStage(const std::string& description, int stage, int numStages);
+
   IddFileAndFactoryWrapper getIddFile(const VersionString& version);
 
   void update(const VersionString& startVersion);
@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "OSVersionFixture.hpp"
+#include "../ComponentLibraryCache.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Component.hpp"
+#include "../../model/Construction.hpp"
+#include "../../model/Construction_Impl.hpp"
+#include "../../model/SpaceType.hpp"
+#include "../../model/SpaceType_Impl.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <OpenStudio.hxx>
+
+using namespace openstudio;
+using namespace openstudio::osversion;
+
+TEST_F(OSVersionFixture, ComponentLibraryCache) {
+  openstudio::path dir = openstudio::tempDir() / toPath("ComponentLibraryCache");
+  openstudio::filesystem::remove_all(dir);
+  openstudio::filesystem::create_directories(dir);
+  openstudio::path libraryPath = dir / toPath("library.osm");
+  openstudio::path cacheDir = dir / toPath("cache");
+
+  model::Model library = model::exampleModel();
+  model::SpaceType spaceType(library);
+  spaceType.setName("Cached Office");
+  spaceType.setStandardsBuildingType("Office");
+  spaceType.setStandardsSpaceType("OpenOffice");
+  ASSERT_TRUE(library.save(libraryPath, true));
+
+  ComponentLibraryCache cache(cacheDir);
+  EXPECT_FALSE(cache.isCached(libraryPath));
+
+  // first load translates the library and writes the cache
+  boost::optional<model::Model> loaded = cache.loadLibrary(libraryPath);
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ(library.objects().size(), loaded->objects().size());
+  EXPECT_TRUE(cache.isCached(libraryPath));
+  EXPECT_TRUE(openstudio::filesystem::exists(cache.cachePath(libraryPath)));
+  // caches written by other builds of OpenStudio are not used
+  EXPECT_NE(std::string::npos, toString(cache.cachePath(libraryPath).filename()).find(openStudioLongVersion()));
+
+  // a fresh cache reads the index without loading the library
+  ComponentLibraryCache other(cacheDir);
+  std::vector<LibraryObjectSummary> found = other.find(libraryPath, IddObjectType::OS_SpaceType, "cached office");
+  ASSERT_EQ(1u, found.size());
+  EXPECT_EQ(spaceType.handle(), found[0].handle);
+  found = other.findByStandardsTag(libraryPath, "openoffice");
+  ASSERT_EQ(1u, found.size());
+  EXPECT_EQ(spaceType.handle(), found[0].handle);
+  EXPECT_EQ(library.getModelObjects<model::Construction>().size(),
+            other.find(libraryPath, IddObjectType::OS_Construction).size());
+
+  // pull a single component out of the cached library
+  std::vector<model::Construction> constructions = library.getModelObjects<model::Construction>();
+  ASSERT_FALSE(constructions.empty());
+  boost::optional<model::Component> component = other.loadComponent(libraryPath, constructions[0].handle());
+  ASSERT_TRUE(component);
+  EXPECT_EQ(IddObjectType::OS_Construction, component->primaryObject().iddObjectType());
+
+  // changing the library invalidates the cache, even within the same second
+  model::SpaceType another(library);
+  ASSERT_TRUE(library.save(libraryPath, true));
+  EXPECT_FALSE(cache.isCached(libraryPath));
+  ComponentLibraryCache changed(cacheDir);
+  EXPECT_FALSE(changed.isCached(libraryPath));
+  loaded = changed.loadLibrary(libraryPath);
+  ASSERT_TRUE(loaded);
+  EXPECT_TRUE(loaded->getModelObject<model::SpaceType>(another.handle()));
+}
@@ -541,4 +541,40 @@ TEST_F(OSVersionFixture,KeepHandles) {
   ASSERT_EQ(1u, workspaceObjects.size());
   EXPECT_TRUE(idfObjects[0].handle() == workspaceObjects[0].handle());
 }
-*/
\ No newline at end of file
+*/
+TEST_F(OSVersionFixture, VersionTranslator_ProgressAndCancel)
+{
+  model::Model model;
+  std::stringstream ss;
+  ss << model;
+
+  osversion::VersionTranslator translator;
+  std::vector<std::string> stages;
+  int lastStage = 0;
+  int lastNumStages = 0;
+  translator.setProgressCallback([&](const std::string& description, int stage, int numStages) {
+    stages.push_back(description);
+    EXPECT_LT(lastStage, stage);
+    EXPECT_LE(stage, numStages);
+    lastStage = stage;
+    lastNumStages = numStages;
+  });
+  EXPECT_TRUE(translator.loadModel(ss));
+  ASSERT_FALSE(stages.empty());
+  EXPECT_EQ("Reading file", stages.front());
+  EXPECT_EQ("Building model", stages.back());
+  EXPECT_EQ(lastNumStages, lastStage);
+  EXPECT_FALSE(translator.isCancelled());
+
+  // cancel part way through, as the application does from the GUI thread
+  osversion::VersionTranslator cancelled;
+  cancelled.setProgressCallback([&](const std::string& description, int stage, int numStages) {
+    if (description == "Building workspace") {
+      cancelled.cancel();
+    }
+  });
+  ss.clear();
+  ss.seekg(0);
+  EXPECT_FALSE(cancelled.loadModel(ss));
+  EXPECT_TRUE(cancelled.isCancelled());
+}
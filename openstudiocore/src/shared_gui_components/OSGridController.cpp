@@ -237,6 +237,9 @@ namespace openstudio {
 
   void ObjectSelector::selectAll()
   {
+    // rows are loaded as the user scrolls, selectable objects are only known once every row has been loaded
+    m_grid->gridView()->loadAllRows();
+
     m_selectedObjects.clear();
 
     for (auto obj : m_selectorObjects) {
@@ -1894,10 +1897,11 @@ namespace openstudio {
     //if (m_iddObjectType == iddObjectType) { TODO uncomment, currently used to update views with extensible dropzones, which need to issue their own signal to refresh
     // Update model list
     // m_modelObjects.push_back(object.cast<model::ModelObject>());
-    refreshModelObjects();
+    // The model objects are refreshed by the queued refresh, refreshing them here for every added object
+    // made bulk additions quadratic in the number of objects
 
     // Update row
-    gridView()->requestAddRow(rowCount() - 1);
+    gridView()->requestAddRow(rowCount());
     //}
   }
 
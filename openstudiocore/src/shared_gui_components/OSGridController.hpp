@@ -567,7 +567,7 @@ public:
   virtual int columnCount() const;
 
   // Widget that exists at the given top level coordinates (may contain sub rows).
-  // This will not create a new widget.
+  // This will not create a new widget, returns nullptr if the row has not been loaded by the grid view yet.
   QWidget * cell(int rowIndex, int columnIndex);
 
   model::ModelObject modelObject(int rowIndex);
@@ -52,9 +52,13 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QScrollArea>
+#include <QScrollBar>
 #include <QShowEvent>
 #include <QStackedWidget>
 
+#include <algorithm>
+#include <cmath>
+
 #ifdef Q_OS_MAC
   #define WIDTH  110
   #define HEIGHT 60
@@ -176,6 +180,7 @@ OSGridView::OSGridView(OSGridController * gridController,
   connect(&m_timer, &QTimer::timeout, this, &OSGridView::doRefresh);
 
   if (this->isVisible()) {
+    connectToScrollArea();
     m_gridController->connectToModel();
     refreshAll();
   }
@@ -227,6 +232,10 @@ void OSGridView::requestRemoveRow(int row)
 
 QLayoutItem * OSGridView::itemAtPosition(int row, int column)
 {
+  if (row >= m_numLoadedRows) {
+    return nullptr;
+  }
+
   auto layoutnum = row / ROWS_PER_LAYOUT;
   auto relativerow = row % ROWS_PER_LAYOUT;
 
@@ -388,23 +397,107 @@ void OSGridView::refreshAll()
 {
   // std::cout << " REFRESHALL CALLED " << std::endl;
   m_queueRequests.clear();
+  int numRows = numRowsInView();
   deleteAll();
+  m_numLoadedRows = 0;
 
   if (m_gridController)
   {
     m_gridController->refreshModelObjects();
 
-    for (int i = 0; i < m_gridController->rowCount(); i++)
+    // without a scroll area we cannot tell when more rows are needed, load them all
+    if (m_scrollBar) {
+      loadRows(numRows);
+    } else {
+      loadAllRows();
+    }
+
+    QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
+  }
+}
+
+void OSGridView::loadRows(int numRows)
+{
+  OS_ASSERT(m_gridController);
+
+  numRows = std::min(numRows, m_gridController->rowCount());
+  if (numRows <= m_numLoadedRows) {
+    return;
+  }
+
+  for (int i = m_numLoadedRows; i < numRows; i++)
+  {
+    for (int j = 0; j < m_gridController->columnCount(); j++)
     {
-      for (int j = 0; j < m_gridController->columnCount(); j++)
-      {
-        addWidget(i, j);
-      }
+      addWidget(i, j);
     }
+  }
+  m_numLoadedRows = numRows;
+
+  this->m_gridController->getObjectSelector()->updateWidgets();
+}
 
-    this->m_gridController->getObjectSelector()->updateWidgets();
+void OSGridView::loadAllRows()
+{
+  if (m_gridController) {
+    loadRows(m_gridController->rowCount());
+  }
+}
 
-    QTimer::singleShot(0, this, SLOT(selectRowDeterminedByModelSubTabView()));
+int OSGridView::numRowsInView() const
+{
+  if (!m_scrollBar || (m_numLoadedRows == 0)) {
+    return ROWS_PER_LAYOUT;
+  }
+
+  // the scroll range covers the loaded rows, so the part of it above the bottom of the viewport
+  // tells how many of them are scrolled into or past view
+  double range = m_scrollBar->maximum() - m_scrollBar->minimum() + m_scrollBar->pageStep();
+  double fraction = 1.0;
+  if (range > 0) {
+    fraction = std::min(1.0, (m_scrollBar->value() - m_scrollBar->minimum() + m_scrollBar->pageStep()) / range);
+  }
+  int rows = static_cast<int>(std::ceil(fraction * m_numLoadedRows));
+
+  // round up to whole pages, keeping one page below the viewport like onScrollBarValueChanged
+  return (rows / ROWS_PER_LAYOUT + 1) * ROWS_PER_LAYOUT;
+}
+
+void OSGridView::onScrollBarValueChanged(int value)
+{
+  if (!m_gridController || !m_scrollBar || (m_numLoadedRows >= m_gridController->rowCount())) {
+    return;
+  }
+
+  // load the next page once the user gets within a page of the bottom
+  if (value >= m_scrollBar->maximum() - m_scrollBar->pageStep()) {
+    loadRows(m_numLoadedRows + ROWS_PER_LAYOUT);
+  }
+}
+
+void OSGridView::connectToScrollArea()
+{
+  QScrollArea * scrollArea = nullptr;
+  for (QWidget * widget = parentWidget(); widget; widget = widget->parentWidget()) {
+    scrollArea = qobject_cast<QScrollArea *>(widget);
+    if (scrollArea) {
+      break;
+    }
+  }
+
+  QScrollBar * scrollBar = scrollArea ? scrollArea->verticalScrollBar() : nullptr;
+  if (scrollBar == m_scrollBar) {
+    return;
+  }
+
+  if (m_scrollBar) {
+    disconnect(m_scrollBar, &QScrollBar::valueChanged, this, &OSGridView::onScrollBarValueChanged);
+  }
+
+  m_scrollBar = scrollBar;
+
+  if (m_scrollBar) {
+    connect(m_scrollBar, &QScrollBar::valueChanged, this, &OSGridView::onScrollBarValueChanged);
   }
 }
 
@@ -431,6 +524,7 @@ void OSGridView::doRowSelect()
 {
   // If the index is valid, do some work
   if (m_gridController->m_oldIndex > -1){
+    loadRows(m_gridController->m_oldIndex + 1);
     m_gridController->selectRow(m_gridController->m_oldIndex, true);
   }
 }
@@ -508,6 +602,7 @@ void OSGridView::hideEvent(QHideEvent * event)
 
 void OSGridView::showEvent(QShowEvent * event)
 {
+  connectToScrollArea();
   m_gridController->connectToModel();
   refreshAll();
 
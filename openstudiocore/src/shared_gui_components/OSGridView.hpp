@@ -30,6 +30,7 @@
 #ifndef SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 #define SHAREDGUICOMPONENTS_OSGRIDVIEW_HPP
 
+#include <QPointer>
 #include <QTimer>
 #include <QWidget>
 
@@ -44,6 +45,7 @@ class QLabel;
 class QShowEvent;
 class QString;
 class QLayoutItem;
+class QScrollBar;
 
 namespace openstudio{
 
@@ -68,8 +70,15 @@ public:
   virtual ~OSGridView() {};
 
   // return the QLayoutItem at a particular partition, accounting for multiple grid layouts
+  // returns nullptr if the row has not been loaded yet
   QLayoutItem * itemAtPosition(int row, int column);
 
+  // make sure widgets exist for the first numRows rows, rows are otherwise loaded a page at a time as the user scrolls
+  void loadRows(int numRows);
+
+  // make sure widgets exist for every row, e.g. before selecting all rows
+  void loadAllRows();
+
   OSDropZone * m_dropZone;
 
   virtual ModelSubTabView * modelSubTabView();
@@ -116,6 +125,8 @@ private slots:
 
   void selectRowDeterminedByModelSubTabView();
 
+  void onScrollBarValueChanged(int value);
+
 private:
 
   enum QueueType
@@ -135,6 +146,12 @@ private:
 
   void setGridController(OSGridController * gridController);
 
+  // find the scroll area containing this view and load more rows when it is scrolled near the bottom
+  void connectToScrollArea();
+
+  // number of rows, in whole pages, that a refresh must load to fill the scroll area down to its current position
+  int numRowsInView() const;
+
   static const int ROWS_PER_LAYOUT = 100;
 
   std::vector<QGridLayout *> m_gridLayouts;
@@ -150,6 +167,12 @@ private:
   int m_rowToAdd = -1;
 
   int m_rowToRemove = -1;
+
+  // number of rows that currently have widgets
+  int m_numLoadedRows = 0;
+
+
+  QPointer<QScrollBar> m_scrollBar;
 };
 
 } // openstudio
@@ -133,7 +133,7 @@ void WaitDialog::resetLabels() {
 
 void WaitDialog::on_cancelButton(bool checked)
 {
-  OSDialog::on_cancelButton(checked);
+  // Do not hide, whoever showed the cancel button hides the dialog once the work has stopped
 }
 
 void WaitDialog::closeEvent(QCloseEvent *e)
@@ -34,6 +34,7 @@
 #include "../core/FilesystemHelpers.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
+#include "../core/Checksum.hpp"
 #include "../core/Assert.hpp"
 
 #include <OpenStudio.hxx>
@@ -1221,6 +1222,9 @@ namespace openstudio{
       m_bclXML.incrementVersionId();
     }
 
+    // persist file checksums so unchanged files are not read by the next check
+    ChecksumCache::instance().save();
+
     return result;
   }
 
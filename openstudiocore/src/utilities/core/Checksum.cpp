@@ -29,23 +29,83 @@
 
 #include "Checksum.hpp"
 
+#include <QMutex>
+#include <QMutexLocker>
+
 #include <sstream>
+#include <vector>
+#include <cstring>
+#include <ctime>
 
-#include <boost/crc.hpp>
+#include <boost/cstdint.hpp>
 
 
 namespace openstudio {
 
   namespace detail {
 
-    bool checksumIgnore(char c)
+    // lookup tables for slicing-by-8 CRC-32 (reflected polynomial 0xEDB88320), this computes the
+    // same value as boost::crc_32_type but processes 8 bytes per step
+    struct Crc32Tables {
+      boost::uint32_t table[8][256];
+
+      Crc32Tables() {
+        for (boost::uint32_t i = 0; i < 256; ++i) {
+          boost::uint32_t crc = i;
+          for (int j = 0; j < 8; ++j) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+          }
+          table[0][i] = crc;
+        }
+        for (boost::uint32_t i = 0; i < 256; ++i) {
+          for (int k = 1; k < 8; ++k) {
+            table[k][i] = (table[k-1][i] >> 8) ^ table[0][table[k-1][i] & 0xFFu];
+          }
+        }
+      }
+    };
+
+    const Crc32Tables& crc32Tables()
     {
-      // ignore all whitespace
-      //bool result = (c == ' ' || c == '\t' || c == '\n' ||  c == '\v' || c == '\f' || c == '\r');
+      static const Crc32Tables tables;
+      return tables;
+    }
 
-      // ignore just line feed
-      bool result = (c == '\r');
+    // update crc (pre-inverted) with n bytes
+    boost::uint32_t crc32Update(boost::uint32_t crc, const unsigned char* data, size_t n)
+    {
+      const Crc32Tables& t = crc32Tables();
+      while (n >= 8) {
+        boost::uint32_t lo = crc ^ (static_cast<boost::uint32_t>(data[0]) |
+                                    static_cast<boost::uint32_t>(data[1]) << 8 |
+                                    static_cast<boost::uint32_t>(data[2]) << 16 |
+                                    static_cast<boost::uint32_t>(data[3]) << 24);
+        boost::uint32_t hi = (static_cast<boost::uint32_t>(data[4]) |
+                              static_cast<boost::uint32_t>(data[5]) << 8 |
+                              static_cast<boost::uint32_t>(data[6]) << 16 |
+                              static_cast<boost::uint32_t>(data[7]) << 24);
+        crc = t.table[7][lo & 0xFFu] ^ t.table[6][(lo >> 8) & 0xFFu] ^
+              t.table[5][(lo >> 16) & 0xFFu] ^ t.table[4][lo >> 24] ^
+              t.table[3][hi & 0xFFu] ^ t.table[2][(hi >> 8) & 0xFFu] ^
+              t.table[1][(hi >> 16) & 0xFFu] ^ t.table[0][hi >> 24];
+        data += 8;
+        n -= 8;
+      }
+      while (n > 0) {
+        crc = (crc >> 8) ^ t.table[0][(crc ^ *data) & 0xFFu];
+        ++data;
+        --n;
+      }
+      return crc;
+    }
 
+    std::string checksumToString(boost::uint32_t crc)
+    {
+      std::stringstream ss;
+      ss << std::hex << std::uppercase << crc;
+      std::string result = "00000000";
+      std::string checksum = ss.str();
+      result.replace(8-checksum.size(), checksum.size(), checksum);
       return result;
     }
   }
@@ -60,29 +120,25 @@ namespace openstudio {
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    boost::uint32_t crc = 0xFFFFFFFFu;
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(static_cast<size_t>(n));
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
-      std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-
-      crc.process_bytes(str.c_str(), stringSize);
-    } while ( is );
+      is.read(&buffer[0], n);
+      size_t readSize = static_cast<size_t>(is.gcount());
 
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
+      // process runs of bytes between ignored characters without copying
+      const char* begin = &buffer[0];
+      const char* end = begin + readSize;
+      while (begin < end) {
+        const char* ignored = static_cast<const char*>(std::memchr(begin, '\r', end - begin));
+        const char* runEnd = ignored ? ignored : end;
+        crc = detail::crc32Update(crc, reinterpret_cast<const unsigned char*>(begin), runEnd - begin);
+        begin = ignored ? ignored + 1 : end;
+      }
+    } while ( is );
 
-    return result;
+    return detail::checksumToString(crc ^ 0xFFFFFFFFu);
   }
 
   /// return 8 character hex checksum of file contents
@@ -99,4 +155,134 @@ namespace openstudio {
     return result;
   }
 
+  ChecksumCache::ChecksumCache(const path& cachePath)
+    : m_cachePath(cachePath), m_dirty(false), m_mutex(new QMutex())
+  {
+    load();
+  }
+
+  ChecksumCache::~ChecksumCache()
+  {
+    delete m_mutex;
+  }
+
+  ChecksumCache& ChecksumCache::instance()
+  {
+    static ChecksumCache cache(openstudio::filesystem::temp_directory_path() / toPath("openstudio_checksums.txt"));
+    return cache;
+  }
+
+  path ChecksumCache::cachePath() const
+  {
+    return m_cachePath;
+  }
+
+  std::string ChecksumCache::checksum(const path& p)
+  {
+    boost::uintmax_t size = 0;
+    std::time_t lastWriteTime = 0;
+    try{
+      if (!openstudio::filesystem::is_regular_file(p)) {
+        return openstudio::checksum(p);
+      }
+      size = openstudio::filesystem::file_size(p);
+      lastWriteTime = openstudio::filesystem::last_write_time(p);
+    }catch(...){
+      return openstudio::checksum(p);
+    }
+
+    std::string key = toString(openstudio::filesystem::system_complete(p));
+    {
+      QMutexLocker lock(m_mutex);
+      auto it = m_entries.find(key);
+      if ((it != m_entries.end()) && (it->second.size == size) && (it->second.lastWriteTime == lastWriteTime)) {
+        return it->second.checksum;
+      }
+    }
+
+    std::string result = openstudio::checksum(p);
+
+    // last write times only have one second resolution, so a file written in the last couple of
+    // seconds could be changed again without changing its key. do not cache those.
+    if (lastWriteTime + 2 < std::time(nullptr)) {
+      QMutexLocker lock(m_mutex);
+      Entry& entry = m_entries[key];
+      entry.size = size;
+      entry.lastWriteTime = lastWriteTime;
+      entry.checksum = result;
+      m_dirty = true;
+    }
+
+    return result;
+  }
+
+  bool ChecksumCache::save()
+  {
+    QMutexLocker lock(m_mutex);
+    if (!m_dirty) {
+      return true;
+    }
+
+    // write to a temporary file and rename so concurrent readers never see a partial cache
+    path tempPath = m_cachePath;
+    tempPath += toPath("." + toString(openstudio::filesystem::unique_path()));
+    try{
+      {
+        openstudio::filesystem::ofstream ofs(tempPath, std::ios_base::binary | std::ios_base::trunc);
+        if (!ofs) {
+          return false;
+        }
+        for (const auto& p : m_entries) {
+          ofs << p.second.checksum << '\t' << p.second.size << '\t' << p.second.lastWriteTime << '\t' << p.first << '\n';
+        }
+        if (!ofs) {
+          return false;
+        }
+      }
+      openstudio::filesystem::rename(tempPath, m_cachePath);
+    }catch(...){
+      try{
+        openstudio::filesystem::remove(tempPath);
+      }catch(...){
+      }
+      return false;
+    }
+
+    m_dirty = false;
+    return true;
+  }
+
+  void ChecksumCache::clear()
+  {
+    QMutexLocker lock(m_mutex);
+    m_dirty = !m_entries.empty();
+    m_entries.clear();
+  }
+
+  void ChecksumCache::load()
+  {
+    try{
+      openstudio::filesystem::ifstream ifs(m_cachePath, std::ios_base::binary);
+      std::string line;
+      while (std::getline(ifs, line)) {
+        std::stringstream ss(line);
+        Entry entry;
+        long long lastWriteTime = 0;
+        if (!(ss >> entry.checksum >> entry.size >> lastWriteTime) || (entry.checksum.size() != 8)) {
+          continue;
+        }
+        entry.lastWriteTime = static_cast<std::time_t>(lastWriteTime);
+        if (ss.get() != '\t') {
+          continue;
+        }
+        std::string key;
+        std::getline(ss, key);
+        if (!key.empty()) {
+          m_entries[key] = entry;
+        }
+      }
+    }catch(...){
+    }
+  }
+
 } // openstudio
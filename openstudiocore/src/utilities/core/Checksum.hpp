@@ -35,6 +35,12 @@
 
 #include <string>
 #include <ostream>
+#include <map>
+#include <ctime>
+
+#include <boost/cstdint.hpp>
+
+class QMutex;
 
 namespace openstudio {
 
@@ -47,6 +53,49 @@ namespace openstudio {
   /// return 8 character hex checksum of file contents
   UTILITIES_API std::string checksum(const path& p);
 
+  /** ChecksumCache stores file checksums keyed by path, size and last write time, so that files
+   *  which have not changed are not read again. The cache is loaded from cachePath on construction
+   *  and written back by save(). */
+  class UTILITIES_API ChecksumCache {
+   public:
+
+    explicit ChecksumCache(const path& cachePath);
+
+    ~ChecksumCache();
+
+    /// process wide cache stored in the temp directory, used by BCLMeasure
+    static ChecksumCache& instance();
+
+    path cachePath() const;
+
+    /// return 8 character hex checksum of file contents, only reading the file if it has changed
+    std::string checksum(const path& p);
+
+    /// write the cache to cachePath if it has changed, returns false on failure
+    bool save();
+
+    /// remove all entries
+    void clear();
+
+   private:
+
+    ChecksumCache(const ChecksumCache& other);
+    ChecksumCache& operator=(const ChecksumCache& other);
+
+    void load();
+
+    struct Entry {
+      boost::uintmax_t size;
+      std::time_t lastWriteTime;
+      std::string checksum;
+    };
+
+    path m_cachePath;
+    std::map<std::string, Entry> m_entries;
+    bool m_dirty;
+    QMutex* m_mutex;
+  };
+
 } // openstudio
 
 
@@ -15,6 +15,30 @@
 %include <utilities/core/Deprecated.hpp>
 %include <utilities/core/Containers.hpp>
 
+// packed conversions cross the binding boundary once rather than once per element, the helpers are
+// defined in the LanguageSpecific.i files, the extension has to precede the template instantiation
+%extend std::vector<double> {
+  #if defined(SWIGRUBY)
+    VALUE packedArray() const {
+      return openstudioPackedArray(self->data(), self->size());
+    }
+  #endif
+
+  #if defined(SWIGPYTHON)
+    PyObject* tolist() const {
+      return openstudioPackedList(self->data(), self->size());
+    }
+
+    PyObject* _arrayInterface() const {
+      return openstudioArrayInterface(self->data(), self->size());
+    }
+
+    %pythoncode %{
+      __array_interface__ = property(_arrayInterface)
+    %}
+  #endif
+}
+
 %template(BoolVector) std::vector<bool>;
 %template(UnsignedVector) std::vector<unsigned>;
 %template(IntVector) std::vector<int>;
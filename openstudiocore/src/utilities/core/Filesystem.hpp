@@ -77,10 +77,12 @@ namespace filesystem {
   using boost::filesystem::last_write_time;
   using boost::filesystem::remove;
   using boost::filesystem::remove_all;
+  using boost::filesystem::rename;
   using boost::filesystem::file_size;
   using boost::filesystem::system_complete;
   using boost::filesystem::temp_directory_path;
   using boost::filesystem::read_symlink;
+  using boost::filesystem::unique_path;
 
 
 }
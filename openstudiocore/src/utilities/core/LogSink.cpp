@@ -53,6 +53,7 @@ namespace openstudio{
 
     LogSink_Impl::~LogSink_Impl()
     {
+      removeSinkFilter(m_sink.get());
       delete m_mutex;
     }
 
@@ -226,6 +227,8 @@ namespace openstudio{
                            expr::matches(expr::attr< LogChannel >("Channel"), filterChannelRegex));
       }
 
+      setSinkFilter(m_sink.get(), filterLogLevel, m_channelRegex);
+
     }
 
   } // detail
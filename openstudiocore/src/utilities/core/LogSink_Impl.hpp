@@ -127,6 +127,15 @@ namespace openstudio{
       boost::shared_ptr<LogSinkBackend> m_sink;
     };
 
+    /// record the level and channel filter of sink, used by logLevelEnabled
+    void setSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex);
+
+    /// record whether sink is registered in the logging core, used by logLevelEnabled
+    void setSinkEnabled(const LogSinkBackend* sink, bool enabled);
+
+    /// forget the filter of sink unless it is still enabled
+    void removeSinkFilter(const LogSinkBackend* sink);
+
   } // detail
 
 } // openstudio
@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "Logger.hpp"
+#include "LogSink_Impl.hpp"
 
 #include <boost/log/common.hpp>
 #include <boost/log/attributes/function.hpp>
@@ -38,6 +39,8 @@
 #include <QReadWriteLock>
 #include <QThread>
 
+#include <atomic>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 
@@ -79,6 +82,130 @@ namespace openstudio{
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
+  namespace detail {
+
+    struct SinkFilter {
+      LogLevel logLevel;
+      boost::optional<boost::regex> channelRegex;
+      bool enabled;
+    };
+
+    // filters of all sinks, kept separately from LoggerSingleton because sinks are configured while
+    // the singleton is being constructed
+    struct SinkFilters {
+      SinkFilters() : minLogLevel(Fatal + 1) {}
+
+      QReadWriteLock mutex;
+      std::map<const LogSinkBackend*, SinkFilter> filters;
+
+      // minimum level accepted by any enabled sink for each channel logged so far
+      std::map<LogChannel, int> channelLogLevels;
+
+      // minimum level accepted by any enabled sink
+      std::atomic<int> minLogLevel;
+
+      // call with write lock held
+      void update()
+      {
+        int result = Fatal + 1;
+        for (const auto& filter : filters) {
+          if (filter.second.enabled && (filter.second.logLevel < result)) {
+            result = filter.second.logLevel;
+          }
+        }
+        minLogLevel = result;
+        channelLogLevels.clear();
+      }
+    };
+
+    // never destroyed, sinks may be destroyed after static destruction begins
+    SinkFilters& sinkFilters()
+    {
+      static SinkFilters* filters = new SinkFilters();
+      return *filters;
+    }
+
+    void setSinkFilter(const LogSinkBackend* sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex)
+    {
+      SinkFilters& sf = sinkFilters();
+      QWriteLocker l(&sf.mutex);
+
+      auto it = sf.filters.find(sink);
+      if (it == sf.filters.end()){
+        SinkFilter filter;
+        filter.enabled = false;
+        it = sf.filters.insert(std::make_pair(sink, filter)).first;
+      }
+      it->second.logLevel = logLevel;
+      it->second.channelRegex = channelRegex;
+
+      sf.update();
+    }
+
+    void setSinkEnabled(const LogSinkBackend* sink, bool enabled)
+    {
+      SinkFilters& sf = sinkFilters();
+      QWriteLocker l(&sf.mutex);
+
+      auto it = sf.filters.find(sink);
+      if (it == sf.filters.end()){
+        // sink was never configured, it accepts everything
+        SinkFilter filter;
+        filter.logLevel = Trace;
+        it = sf.filters.insert(std::make_pair(sink, filter)).first;
+      }
+      it->second.enabled = enabled;
+
+      sf.update();
+    }
+
+    void removeSinkFilter(const LogSinkBackend* sink)
+    {
+      SinkFilters& sf = sinkFilters();
+      QWriteLocker l(&sf.mutex);
+
+      auto it = sf.filters.find(sink);
+      if ((it != sf.filters.end()) && !it->second.enabled){
+        sf.filters.erase(it);
+      }
+    }
+
+  } // detail
+
+  bool logLevelEnabled(LogLevel level)
+  {
+    return level >= detail::sinkFilters().minLogLevel.load(std::memory_order_relaxed);
+  }
+
+  bool logLevelEnabled(LogLevel level, const LogChannel& channel)
+  {
+    detail::SinkFilters& sf = detail::sinkFilters();
+    QReadLocker l(&sf.mutex);
+
+    auto it = sf.channelLogLevels.find(channel);
+    if (it != sf.channelLogLevels.end()){
+      return level >= it->second;
+    }
+
+    // match the channel against each enabled sink once
+    l.unlock();
+    QWriteLocker l2(&sf.mutex);
+
+    int result = Fatal + 1;
+    for (const auto& filter : sf.filters) {
+      if (!filter.second.enabled || (filter.second.logLevel >= result)) {
+        continue;
+      }
+      if (filter.second.channelRegex && !boost::regex_match(channel, *filter.second.channelRegex)) {
+        continue;
+      }
+      result = filter.second.logLevel;
+    }
+    sf.channelLogLevels[channel] = result;
+
+    return level >= result;
+  }
+
   LoggerSingleton::LoggerSingleton()
     : m_mutex(new QReadWriteLock())
   {
@@ -173,6 +300,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
+
+      detail::setSinkEnabled(sink.get(), true);
     }
   }
 
@@ -192,6 +321,8 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+
+      detail::setSinkEnabled(sink.get(), false);
     }
   }
 
@@ -58,12 +58,18 @@ class QWriteLocker;
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is only formatted if an enabled
+/// sink accepts messages at this level and channel
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (openstudio::logLevelEnabled(__level__)) { \
+      const openstudio::LogChannel _channel1(__channel__); \
+      if (openstudio::logLevelEnabled(__level__, _channel1)) { \
+        std::stringstream _ss1; \
+        _ss1 << __message__; \
+        openstudio::logFree(__level__, _channel1, _ss1.str()); \
+      } \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -80,6 +86,13 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// returns true if any enabled sink accepts messages at level, this is a single atomic read
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
+  /// returns true if any enabled sink accepts messages at level on channel, results for each
+  /// channel are cached until a sink is enabled, disabled, or its filter changes
+  UTILITIES_API bool logLevelEnabled(LogLevel level, const LogChannel& channel);
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
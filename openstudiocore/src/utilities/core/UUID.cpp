@@ -154,6 +154,52 @@ boost::regex &uuidInString() {
   return result;
 }
 
+// Matches the pattern of uuidInString starting at str[pos], str must have at least pos + 38 characters
+static bool isUUIDInStringAt(const std::string& str, std::string::size_type pos)
+{
+  static const char pattern[] = "{xxxxxxxx-xxxx-4xxx-vxxx-xxxxxxxxxxxx}";
+  for (unsigned i = 0; i < 38; ++i){
+    char c = str[pos + i];
+    switch (pattern[i]){
+      case 'x':
+        if (!((c >= 'a' && c <= 'f') || (c >= '0' && c <= '9'))){
+          return false;
+        }
+        break;
+      case 'v':
+        if (!(c == '8' || c == '9' || c == 'a' || c == 'A' || c == 'b' || c == 'B')){
+          return false;
+        }
+        break;
+      default:
+        if (c != pattern[i]){
+          return false;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+std::vector<std::pair<std::string::size_type, UUID> > findUUIDsInString(const std::string& str)
+{
+  std::vector<std::pair<std::string::size_type, UUID> > result;
+  if (str.size() < 38){
+    return result;
+  }
+
+  std::string::size_type pos = str.find('{');
+  while ((pos != std::string::npos) && (pos + 38 <= str.size())){
+    if (isUUIDInStringAt(str, pos)){
+      result.push_back(std::make_pair(pos, toUUID(str.substr(pos, 38))));
+      pos = str.find('{', pos + 38);
+    }else{
+      pos = str.find('{', pos + 1);
+    }
+  }
+  return result;
+}
+
 bool operator!= ( const UUID & lhs, const UUID & rhs ) {
   return static_cast<const boost::uuids::uuid&>(lhs) != static_cast<const boost::uuids::uuid&>(rhs);
 }
@@ -37,6 +37,7 @@
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <vector>
+#include <utility>
 #include <ostream>
 #include <string>
 
@@ -108,6 +109,10 @@ namespace openstudio {
   /// Find version 4 UUIDs in a string.
   UTILITIES_API boost::regex &uuidInString();
 
+  /// Find version 4 UUIDs in a string, matches the same UUIDs as uuidInString without the cost of a regex search.
+  /// Returns the position of the opening curly bracket of each UUID along with the UUID.
+  UTILITIES_API std::vector<std::pair<std::string::size_type, UUID> > findUUIDsInString(const std::string& str);
+
   /// create a unique name, prefix << " " << UUID.
   UTILITIES_API std::string createUniqueName(const std::string& prefix);
 
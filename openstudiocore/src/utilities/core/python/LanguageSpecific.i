@@ -14,4 +14,27 @@
 #endif
 %}
 
+// converts contiguous doubles to a list in a single call, used by tolist methods
+%{
+  SWIGINTERN PyObject* openstudioPackedList(const double* values, size_t n) {
+    PyObject* result = PyList_New(static_cast<Py_ssize_t>(n));
+    for (size_t i = 0; i < n; ++i) {
+      PyList_SET_ITEM(result, static_cast<Py_ssize_t>(i), PyFloat_FromDouble(values[i]));
+    }
+    return result;
+  }
+
+  // read only NumPy array interface (version 3) viewing values in place,
+  // numpy.asarray keeps the object providing the interface alive
+  SWIGINTERN PyObject* openstudioArrayInterface(const double* values, size_t n) {
+    static const int one = 1;
+    const char* typestr = (*reinterpret_cast<const char*>(&one) == 1) ? "<f8" : ">f8";
+    return Py_BuildValue("{s:(n),s:s,s:(N,O),s:i}",
+                         "shape", static_cast<Py_ssize_t>(n),
+                         "typestr", typestr,
+                         "data", PyLong_FromVoidPtr(const_cast<double*>(values)), Py_True,
+                         "version", 3);
+  }
+%}
+
 #endif
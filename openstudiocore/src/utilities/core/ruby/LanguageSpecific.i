@@ -204,6 +204,17 @@ namespace boost {
 
 %rename(multiplyEqual) operator *=;
 
+// converts contiguous doubles to a Ruby Array in a single call, used by packedArray methods
+%{
+  SWIGINTERN VALUE openstudioPackedArray(const double* values, size_t n) {
+    VALUE result = rb_ary_new2(n);
+    for (size_t i = 0; i < n; ++i) {
+      rb_ary_push(result, rb_float_new(values[i]));
+    }
+    return result;
+  }
+%}
+
 
 
 #endif // UTILITIES_RUBY_LANGUAGESPECIFIC_I
@@ -125,3 +125,63 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart,itEnd,*it) == itEnd);
   }
 }
+
+TEST(Checksum, LargeStrings)
+{
+  // longer than the read buffer, carriage returns are ignored across buffer boundaries
+  string s;
+  for (unsigned i = 0; i < 20000; ++i) {
+    s += "Hi there\r\nGoodbye\r\n";
+  }
+  string t;
+  for (unsigned i = 0; i < 20000; ++i) {
+    t += "Hi there\nGoodbye\n";
+  }
+  EXPECT_EQ(checksum(t), checksum(s));
+  EXPECT_NE(checksum(t), checksum(t + "\n"));
+}
+
+TEST(Checksum, ChecksumCache)
+{
+  path cachePath = openstudio::filesystem::temp_directory_path() / toPath("ChecksumCache_GTest.txt");
+  if (openstudio::filesystem::exists(cachePath)) {
+    openstudio::filesystem::remove(cachePath);
+  }
+
+  path p = openstudio::filesystem::temp_directory_path() / toPath("ChecksumCache_GTest_File.txt");
+  {
+    openstudio::filesystem::ofstream ofs(p);
+    ofs << "Hi there";
+  }
+  // recently written files are not cached, pretend this one is old
+  std::time_t lastWriteTime = std::time(nullptr) - 3600;
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+
+  {
+    openstudio::ChecksumCache cache(cachePath);
+    EXPECT_EQ("1AD514BA", cache.checksum(p));
+    EXPECT_TRUE(cache.save());
+  }
+  EXPECT_TRUE(openstudio::filesystem::exists(cachePath));
+
+  {
+    // same size and write time, cached value is returned without reading the file
+    openstudio::filesystem::ofstream ofs(p);
+    ofs << "HI there";
+  }
+  openstudio::filesystem::last_write_time(p, lastWriteTime);
+  EXPECT_EQ("D5682D26", checksum(p));
+
+  openstudio::ChecksumCache cache(cachePath);
+  EXPECT_EQ("1AD514BA", cache.checksum(p));
+
+  // changed write time invalidates the entry
+  openstudio::filesystem::last_write_time(p, lastWriteTime + 1);
+  EXPECT_EQ("D5682D26", cache.checksum(p));
+
+  // missing files are not cached
+  EXPECT_EQ("00000000", cache.checksum(resourcesPath() / toPath("utilities/Checksum/NotAFile.txt")));
+
+  openstudio::filesystem::remove(p);
+  openstudio::filesystem::remove(cachePath);
+}
@@ -83,6 +83,16 @@ namespace
     LOG_FREE(Error, "free.channel", "Free Error");
   }
 
+  struct FormatCounter{
+    unsigned* count;
+  };
+
+  std::ostream& operator<<(std::ostream& os, const FormatCounter& formatCounter)
+  {
+    ++(*formatCounter.count);
+    return os << "Counted";
+  }
+
   void classLogging()
   {
     Hello h;
@@ -205,6 +215,39 @@ namespace
     EXPECT_EQ("Free Error", sink.logMessages()[1].logMessage());
   }
 
+  TEST(LoggerTest, level_gate)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Debug);
+    sink.setChannelRegex(boost::regex("gate\\..*"));
+
+    EXPECT_TRUE(openstudio::logLevelEnabled(Debug));
+    EXPECT_TRUE(openstudio::logLevelEnabled(Debug, "gate.channel"));
+    EXPECT_TRUE(openstudio::logLevelEnabled(Error, "gate.channel"));
+
+    unsigned count = 0;
+    LOG_FREE(Debug, "gate.channel", FormatCounter{&count});
+    EXPECT_EQ(1u, count);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Counted", sink.logMessages()[0].logMessage());
+
+    // below the sink level, only formatted if some other enabled sink accepts it
+    sink.resetStringStream();
+    bool otherSinkEnabled = openstudio::logLevelEnabled(Trace, "gate.channel");
+    LOG_FREE(Trace, "gate.channel", FormatCounter{&count});
+    EXPECT_EQ(otherSinkEnabled ? 2u : 1u, count);
+    EXPECT_TRUE(sink.logMessages().empty());
+
+    // raising the level of the sink updates the cached channel level
+    sink.setLogLevel(Error);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Error, "gate.channel"));
+    LOG_FREE(Error, "gate.channel", FormatCounter{&count});
+    EXPECT_EQ(otherSinkEnabled ? 3u : 2u, count);
+    ASSERT_EQ(1u, sink.logMessages().size());
+  }
+
   TEST(LoggerTest, class_logger)
   {
     openstudio::Logger::instance().standardOutLogger().disable();
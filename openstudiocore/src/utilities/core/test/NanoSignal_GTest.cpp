@@ -0,0 +1,236 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <nano/nano_signal_slot.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace nanosignaltest
+{
+
+typedef Nano::Signal<void(int)> IntSignal;
+
+struct Counter : public Nano::Observer
+{
+  Counter() : count(0) {}
+  void increment(int value) { count += value; }
+  int count;
+};
+
+// disconnects the given slot, possibly itself, when called
+struct Disconnector : public Nano::Observer
+{
+  Disconnector(IntSignal& s, Counter& t) : signal(s), target(t), count(0) {}
+  void disconnectTarget(int) { ++count; signal.disconnect<Counter, &Counter::increment>(target); }
+  void disconnectSelf(int) { ++count; signal.disconnect<Disconnector, &Disconnector::disconnectSelf>(this); }
+  IntSignal& signal;
+  Counter& target;
+  int count;
+};
+
+// destroys the counter it owns when called
+struct Destroyer : public Nano::Observer
+{
+  void destroy(int) { victim.reset(); }
+  std::unique_ptr<Counter> victim;
+};
+
+// connects the given counter the first time it is called
+struct Connector : public Nano::Observer
+{
+  Connector(IntSignal& s, Counter& t) : signal(s), target(t), connected(false) {}
+  void connectTarget(int)
+  {
+    if (!connected){
+      signal.connect<Counter, &Counter::increment>(target);
+      connected = true;
+    }
+  }
+  IntSignal& signal;
+  Counter& target;
+  bool connected;
+};
+
+}
+
+using namespace nanosignaltest;
+
+TEST(NanoSignal, Emit)
+{
+  IntSignal signal;
+  EXPECT_TRUE(signal.empty());
+
+  Counter a, b;
+  signal.connect<Counter, &Counter::increment>(a);
+  signal.connect<Counter, &Counter::increment>(b);
+  EXPECT_FALSE(signal.empty());
+
+  signal.nano_emit(2);
+  EXPECT_EQ(2, a.count);
+  EXPECT_EQ(2, b.count);
+}
+
+TEST(NanoSignal, EmitToRemovedConnection)
+{
+  IntSignal signal;
+  Counter a, b;
+  signal.connect<Counter, &Counter::increment>(a);
+  signal.connect<Counter, &Counter::increment>(b);
+
+  signal.disconnect<Counter, &Counter::increment>(a);
+  EXPECT_FALSE(signal.empty());
+  signal.nano_emit(1);
+  EXPECT_EQ(0, a.count);
+  EXPECT_EQ(1, b.count);
+
+  // disconnecting again does nothing
+  signal.disconnect<Counter, &Counter::increment>(a);
+  signal.disconnect<Counter, &Counter::increment>(b);
+  EXPECT_TRUE(signal.empty());
+  signal.nano_emit(1);
+  EXPECT_EQ(0, a.count);
+  EXPECT_EQ(1, b.count);
+
+  // an observer destroyed outside of emission is disconnected
+  {
+    Counter c;
+    signal.connect<Counter, &Counter::increment>(c);
+    EXPECT_FALSE(signal.empty());
+  }
+  EXPECT_TRUE(signal.empty());
+  signal.nano_emit(1);
+}
+
+TEST(NanoSignal, DisconnectDuringEmit)
+{
+  IntSignal signal;
+  Counter counter;
+  Disconnector disconnector(signal, counter);
+
+  // slots are called in reverse order of connection, so disconnector is called first
+  signal.connect<Counter, &Counter::increment>(counter);
+  signal.connect<Disconnector, &Disconnector::disconnectTarget>(disconnector);
+  signal.nano_emit(1);
+  EXPECT_EQ(1, disconnector.count);
+  EXPECT_EQ(0, counter.count);
+
+  signal.nano_emit(1);
+  EXPECT_EQ(2, disconnector.count);
+  EXPECT_EQ(0, counter.count);
+
+  // a slot can disconnect itself, the slots after it are still called
+  signal.disconnect<Disconnector, &Disconnector::disconnectTarget>(disconnector);
+  EXPECT_TRUE(signal.empty());
+  signal.connect<Counter, &Counter::increment>(counter);
+  signal.connect<Disconnector, &Disconnector::disconnectSelf>(disconnector);
+  signal.nano_emit(1);
+  EXPECT_EQ(3, disconnector.count);
+  EXPECT_EQ(1, counter.count);
+
+  signal.nano_emit(1);
+  EXPECT_EQ(3, disconnector.count);
+  EXPECT_EQ(2, counter.count);
+}
+
+TEST(NanoSignal, DestroyObserverDuringEmit)
+{
+  IntSignal signal;
+  Destroyer destroyer;
+  destroyer.victim.reset(new Counter());
+  Counter counter;
+
+  signal.connect<Counter, &Counter::increment>(counter);
+  signal.connect<Counter, &Counter::increment>(*destroyer.victim);
+  signal.connect<Destroyer, &Destroyer::destroy>(destroyer);
+
+  // the destroyed counter is skipped, the slots after it are still called
+  signal.nano_emit(1);
+  EXPECT_FALSE(destroyer.victim);
+  EXPECT_EQ(1, counter.count);
+
+  signal.nano_emit(1);
+  EXPECT_EQ(2, counter.count);
+}
+
+TEST(NanoSignal, ConnectDuringEmit)
+{
+  IntSignal signal;
+  Counter counter;
+  Connector connector(signal, counter);
+  signal.connect<Connector, &Connector::connectTarget>(connector);
+
+  // a slot connected during emission is first called by the next emission
+  signal.nano_emit(1);
+  EXPECT_TRUE(connector.connected);
+  EXPECT_EQ(0, counter.count);
+
+  signal.nano_emit(1);
+  EXPECT_EQ(1, counter.count);
+}
+
+TEST(NanoSignal, ManyConnections)
+{
+  // enough connections for the signal to index them
+  IntSignal signal;
+  std::vector<std::unique_ptr<Counter> > counters;
+  for (unsigned i = 0; i < 20; ++i){
+    counters.emplace_back(new Counter());
+    signal.connect<Counter, &Counter::increment>(*counters.back());
+  }
+  signal.nano_emit(1);
+  for (const auto& counter : counters){
+    EXPECT_EQ(1, counter->count);
+  }
+
+  // disconnect every other counter, and destroy the rest of them during emission
+  Destroyer destroyer;
+  for (unsigned i = 0; i < 20; i += 2){
+    signal.disconnect<Counter, &Counter::increment>(*counters[i]);
+  }
+  destroyer.victim = std::move(counters[1]);
+  signal.connect<Destroyer, &Destroyer::destroy>(destroyer);
+  signal.nano_emit(1);
+  EXPECT_FALSE(destroyer.victim);
+  for (unsigned i = 0; i < 20; ++i){
+    if (i % 2 == 0){
+      EXPECT_EQ(1, counters[i]->count);
+    }else if (i > 1){
+      EXPECT_EQ(2, counters[i]->count);
+    }
+  }
+
+  counters.clear();
+  EXPECT_FALSE(signal.empty());
+  signal.disconnect<Destroyer, &Destroyer::destroy>(destroyer);
+  EXPECT_TRUE(signal.empty());
+  signal.nano_emit(1);
+}
@@ -210,6 +210,13 @@ TEST_F(DataFixture,TimeSeries_DetailedConstructor_FirstReport)
     EXPECT_TRUE(fromSeries[i]==dateTimes[i]);
   }
 
+  // check timestamps
+  TimestampVector timestamps = timeSeries.timestamps();
+  ASSERT_EQ(numValues,timestamps.size());
+  for (unsigned i = 0; i < numValues; ++i){
+    EXPECT_EQ(Timestamp(dateTimes[i]), timestamps[i]);
+  }
+
 }
 
 TEST_F(DataFixture, TimeSeries_DetailedConstructor_Start)
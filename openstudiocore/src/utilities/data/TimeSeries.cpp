@@ -309,9 +309,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
     } else {
       m_secondsFromFirstReport[0] = 0;
       m_secondsFromStart[0] = 0;
+      Timestamp firstReport(m_firstReportDateTime);
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-        m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
+        m_secondsFromFirstReport[i] = static_cast<long>(Timestamp(dateTimes[i]) - firstReport);
+        m_secondsFromStart[i] = m_secondsFromFirstReport[i];
       }
     }
 
@@ -439,6 +440,17 @@ DateTimeVector TimeSeries_Impl::dateTimes() const
   return dateTimeObjs;
 }
 
+TimestampVector TimeSeries_Impl::timestamps() const
+{
+  Timestamp firstReport(m_firstReportDateTime);
+  TimestampVector result;
+  result.reserve(m_secondsFromFirstReport.size());
+  for (long seconds : m_secondsFromFirstReport) {
+    result.push_back(firstReport + seconds);
+  }
+  return result;
+}
+
 /// time in days from end of the first reporting interval
 Vector TimeSeries_Impl::daysFromFirstReport() const
 {
@@ -840,6 +852,11 @@ openstudio::DateTimeVector TimeSeries::dateTimes() const
   return m_impl->dateTimes();
 }
 
+openstudio::TimestampVector TimeSeries::timestamps() const
+{
+  return m_impl->timestamps();
+}
+
 openstudio::DateTime TimeSeries::firstReportDateTime() const
 {
   return m_impl->firstReportDateTime();
@@ -75,6 +75,27 @@ public:
     os << *self;
     return os.str();
   }
+
+  // ublas stores the values contiguously, the helpers are defined in the LanguageSpecific.i files
+  #if defined(SWIGRUBY)
+    VALUE packedArray() const {
+      return openstudioPackedArray(self->size() ? &(*self)[0] : NULL, self->size());
+    }
+  #endif
+
+  #if defined(SWIGPYTHON)
+    PyObject* tolist() const {
+      return openstudioPackedList(self->size() ? &(*self)[0] : NULL, self->size());
+    }
+
+    PyObject* _arrayInterface() const {
+      return openstudioArrayInterface(self->size() ? &(*self)[0] : NULL, self->size());
+    }
+
+    %pythoncode %{
+      __array_interface__ = property(_arrayInterface)
+    %}
+  #endif
 };
 
 
@@ -34,6 +34,7 @@
 #include "../core/Checksum.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../time/Timestamp.hpp"
 
 
 
@@ -4037,6 +4038,35 @@ namespace openstudio{
     return m_designs;
   }
 
+  // Builds a time series from the data points at the given indices. The dates are converted in bulk rather than
+  // constructing a DateTime per point, which dominates the cost for sub-hourly files.
+  static TimeSeries epwTimeSeries(const std::vector<EpwDataPoint> &data, const std::vector<unsigned> &indices,
+    const std::vector<double> &values, int recordsPerHour, const std::string &units)
+  {
+    std::vector<unsigned> months, days;
+    std::vector<int> hours, minutes;
+    months.reserve(indices.size());
+    days.reserve(indices.size());
+    hours.reserve(indices.size());
+    minutes.reserve(indices.size());
+    for (unsigned i : indices) {
+      months.push_back(data[i].month());
+      days.push_back(data[i].day());
+      hours.push_back(data[i].hour());
+      minutes.push_back(data[i].minute());
+    }
+    DateTime firstReport = data[indices.front()].dateTime();
+    TimestampVector timestamps = toTimestamps(firstReport.date().year(), months, days, hours, minutes, true);
+    // The first interval ends at the first report
+    long interval = 3600 / recordsPerHour;
+    std::vector<long> seconds;
+    seconds.reserve(timestamps.size());
+    for (const Timestamp &timestamp : timestamps) {
+      seconds.push_back(static_cast<long>(timestamp - timestamps.front()) + interval);
+    }
+    return TimeSeries(firstReport, seconds, openstudio::createVector(values), units);
+  }
+
   boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string &name)
   {
     if(m_data.size()==0) {
@@ -4066,22 +4096,17 @@ namespace openstudio{
     }
     if(m_data.size() > 0) {
       std::string units = EpwDataPoint::getUnits(id);
-      DateTimeVector dates;
-      dates.push_back(DateTime()); // Use a placeholder to avoid an insert
+      std::vector<unsigned> indices;
       std::vector<double> values;
       for(unsigned int i=0;i<m_data.size();i++) {
-        DateTime dateTime=m_data[i].dateTime();
-        // Time time=m_data[i].time();
         boost::optional<double> value = m_data[i].getField(id);
         if(value) {
-          dates.push_back(DateTime(dateTime));
+          indices.push_back(i);
           values.push_back(value.get());
         }
       }
       if(values.size()) {
-        DateTime start = dates[1] - Time(0, 0, 0, 3600.0 / m_recordsPerHour);
-        dates[0] = start; // Overwrite the placeholder
-        return boost::optional<TimeSeries>(TimeSeries(dates,openstudio::createVector(values),units));
+        return boost::optional<TimeSeries>(epwTimeSeries(m_data, indices, values, m_recordsPerHour, units));
       }
     }
     return boost::none;
@@ -4140,22 +4165,17 @@ namespace openstudio{
       default:
         return boost::none;
     }
-    DateTimeVector dates;
-    dates.push_back(DateTime()); // Use a placeholder to avoid an insert
+    std::vector<unsigned> indices;
     std::vector<double> values;
     for (unsigned int i = 0; i<m_data.size(); i++) {
-      Date date = m_data[i].date();
-      Time time = m_data[i].time();
       boost::optional<double> value = (m_data[i].*compute)();
       if (value) {
-        dates.push_back(DateTime(date, time));
+        indices.push_back(i);
         values.push_back(value.get());
       }
     }
     if (values.size()) {
-      DateTime start = dates[1] - Time(0, 0, 0, 3600.0 / m_recordsPerHour);
-      dates[0] = start; // Overwrite the placeholder
-      return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
+      return boost::optional<TimeSeries>(epwTimeSeries(m_data, indices, values, m_recordsPerHour, units));
     }
     return boost::none;
   }
@@ -13,6 +13,7 @@
   #include <utilities/geometry/Transformation.hpp>
   #include <utilities/geometry/BoundingBox.hpp>
   #include <utilities/geometry/Intersection.hpp>
+  #include <utilities/geometry/PolygonSet.hpp>
   #include <utilities/geometry/ThreeJS.hpp>
   #include <utilities/geometry/FloorplanJS.hpp>
 
@@ -54,6 +55,11 @@
 %template(PlaneVector) std::vector<openstudio::Plane>;
 %template(EulerAnglesVector) std::vector<openstudio::EulerAngles>;
 %template(BoundingBoxVector) std::vector<openstudio::BoundingBox>;
+%template(OptionalIntersectionResultVector) std::vector<boost::optional<openstudio::IntersectionResult> >;
+// for PolygonSet, which has a value per polygon or none if the polygon is degenerate
+%template(VectorOfOptionalPoint3d) std::vector<boost::optional<openstudio::Point3d> >;
+%template(VectorOfOptionalVector3d) std::vector<boost::optional<openstudio::Vector3d> >;
+%template(VectorOfOptionalDouble) std::vector<boost::optional<double> >; // OptionalDoubleVector is boost::optional<std::vector<double> >
 %ignore std::vector<openstudio::ThreeSceneChild>::vector(size_type);
 %ignore std::vector<openstudio::ThreeSceneChild>::resize(size_type);
 %template(ThreeSceneChildVector) std::vector<openstudio::ThreeSceneChild>;
@@ -78,6 +84,7 @@
 %include <utilities/geometry/Transformation.hpp>
 %include <utilities/geometry/BoundingBox.hpp>
 %include <utilities/geometry/Intersection.hpp>
+%include <utilities/geometry/PolygonSet.hpp>
 %include <utilities/geometry/ThreeJS.hpp>
 %include <utilities/geometry/FloorplanJS.hpp>
 
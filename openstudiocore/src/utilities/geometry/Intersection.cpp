@@ -50,9 +50,16 @@ typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
 typedef boost::geometry::model::ring<BoostPoint> BoostRing;
 typedef boost::geometry::model::multi_polygon<BoostPolygon> BoostMultiPolygon;
+typedef boost::geometry::model::box<BoostPoint> BoostBox;
 
 #include <polypartition/polypartition.h>
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
 
 // remove_spikes
 // adapted from https://github.com/boostorg/geometry/commits/develop/include/boost/geometry/algorithms/remove_spikes.hpp eb3260708eb241d8da337f4be73b41d69d33cd09
@@ -321,6 +328,104 @@ namespace openstudio{
 
   // Private implementation functions
 
+  namespace {
+
+  // Merges points within tolerance of each other, equivalent to calling getCombinedPoint with a shared
+  // vector of points.  Points are bucketed on a grid with cell size equal to tol so each lookup only
+  // checks the neighboring cells instead of every point seen so far.
+  class PointSnapper {
+  public:
+
+    explicit PointSnapper(double tol)
+      : m_tol(tol)
+    {}
+
+    // returns the first point added within tol of point, adds point if there is none
+    Point3d combine(const Point3d& point)
+    {
+      long long cellX = cell(point.x());
+      long long cellY = cell(point.y());
+
+      // points are matched in the order they were added, same as getCombinedPoint
+      size_t match = m_points.size();
+      for (long long i = cellX - 1; i <= cellX + 1; ++i){
+        for (long long j = cellY - 1; j <= cellY + 1; ++j){
+          auto it = m_cells.find(std::make_pair(i, j));
+          if (it == m_cells.end()){
+            continue;
+          }
+          for (size_t index : it->second){
+            if (index >= match){
+              break;
+            }
+            const Point3d& otherPoint = m_points[index];
+            if (std::sqrt(std::pow(point.x()-otherPoint.x(), 2) + std::pow(point.y()-otherPoint.y(), 2) + std::pow(point.z()-otherPoint.z(), 2)) < m_tol){
+              match = index;
+              break;
+            }
+          }
+        }
+      }
+
+      if (match < m_points.size()){
+        return m_points[match];
+      }
+
+      m_cells[std::make_pair(cellX, cellY)].push_back(m_points.size());
+      m_points.push_back(point);
+      return point;
+    }
+
+    // all unique points in the order they were added
+    const std::vector<Point3d>& points() const
+    {
+      return m_points;
+    }
+
+    // removes points added after the first n, used to reuse the points of one polygon for several others
+    void truncate(size_t n)
+    {
+      while (m_points.size() > n){
+        const Point3d& point = m_points.back();
+        auto it = m_cells.find(std::make_pair(cell(point.x()), cell(point.y())));
+        OS_ASSERT(it != m_cells.end());
+        OS_ASSERT(it->second.back() == m_points.size() - 1);
+        it->second.pop_back();
+        if (it->second.empty()){
+          m_cells.erase(it);
+        }
+        m_points.pop_back();
+      }
+    }
+
+  private:
+
+    struct CellHash {
+      size_t operator()(const std::pair<long long, long long>& key) const
+      {
+        size_t seed = 0;
+        boost::hash_combine(seed, key.first);
+        boost::hash_combine(seed, key.second);
+        return seed;
+      }
+    };
+
+    long long cell(double value) const
+    {
+      if (m_tol > 0){
+        return static_cast<long long>(std::floor(value / m_tol));
+      }
+      return 0;
+    }
+
+    double m_tol;
+    std::vector<Point3d> m_points;
+    // indices into m_points in increasing order for each grid cell
+    std::unordered_map<std::pair<long long, long long>, std::vector<size_t>, CellHash> m_cells;
+  };
+
+  } // namespace
+
   BoostPolygon removeSpikes(const BoostPolygon& polygon)
   {
     BoostPolygon temp(polygon);
@@ -421,7 +526,7 @@ namespace openstudio{
   }
 
   // convert a Point3d to a BoostPoint
-  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, std::vector<Point3d>& allPoints, double tol)
+  boost::tuple<double, double> boostPointFromPoint3d(const Point3d& point3d, PointSnapper& snapper, double tol)
   {
     OS_ASSERT(abs(point3d.z()) <= tol);
 
@@ -429,13 +534,13 @@ namespace openstudio{
     //return boost::make_tuple(point3d.x(), point3d.y());
 
     // detailed method, try to combine points within tolerance
-    Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+    Point3d resultPoint = snapper.combine(point3d);
 
     return boost::make_tuple(resultPoint.x(), resultPoint.y());
   }
 
   // convert vertices to a boost polygon, all vertices must lie on z = 0 plane
-  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> boostPolygonFromVertices(const std::vector<Point3d>& vertices, PointSnapper& snapper, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
@@ -452,11 +557,11 @@ namespace openstudio{
       }
 
       // use helper method which combines close points
-      boost::geometry::append(polygon, boostPointFromPoint3d(vertex, allPoints, tol));
+      boost::geometry::append(polygon, boostPointFromPoint3d(vertex, snapper, tol));
     }
 
     // close polygon, use helper method which combines close points
-    boost::geometry::append(polygon, boostPointFromPoint3d(vertices[0], allPoints, tol));
+    boost::geometry::append(polygon, boostPointFromPoint3d(vertices[0], snapper, tol));
 
     //boost::geometry::correct(polygon);
 
@@ -469,9 +574,9 @@ namespace openstudio{
     return polygon;
   }
 
-  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostPolygon> nonIntersectingBoostPolygonFromVertices(const std::vector<Point3d>& polygon, PointSnapper& snapper, double tol)
   {
-    boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostPolygon> result = boostPolygonFromVertices(polygon, snapper, tol);
     if (!result){
       return boost::none;
     }
@@ -486,7 +591,7 @@ namespace openstudio{
   }
 
   // convert vertices to a boost ring, all vertices must lie on z = 0 plane
-  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> boostRingFromVertices(const std::vector<Point3d>& vertices, PointSnapper& snapper, double tol)
   {
     if (vertices.size () < 3){
       return boost::none;
@@ -503,11 +608,11 @@ namespace openstudio{
       }
 
       // use helper method which combines close points
-      boost::geometry::append(ring, boostPointFromPoint3d(vertex, allPoints, tol));
+      boost::geometry::append(ring, boostPointFromPoint3d(vertex, snapper, tol));
     }
 
     // close polygon, use helper method which combines close points
-    boost::geometry::append(ring, boostPointFromPoint3d(vertices[0], allPoints, tol));
+    boost::geometry::append(ring, boostPointFromPoint3d(vertices[0], snapper, tol));
 
     //boost::geometry::correct(ring);
 
@@ -520,9 +625,9 @@ namespace openstudio{
     return ring;
   }
 
-  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, std::vector<Point3d>& allPoints, double tol)
+  boost::optional<BoostRing> nonIntersectingBoostRingFromVertices(const std::vector<Point3d>& polygon, PointSnapper& snapper, double tol)
   {
-    boost::optional<BoostRing> result = boostRingFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostRing> result = boostRingFromVertices(polygon, snapper, tol);
     if (!result){
       return boost::none;
     }
@@ -537,7 +642,7 @@ namespace openstudio{
   }
 
   // convert a boost polygon to vertices
-  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostPolygon(const BoostPolygon& polygon, PointSnapper& snapper, double tol)
   {
     std::vector<Point3d> result;
 
@@ -551,7 +656,7 @@ namespace openstudio{
       Point3d point3d(outer[i].x(), outer[i].y(), 0.0);
 
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = snapper.combine(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -579,7 +684,7 @@ namespace openstudio{
   }
 
   // convert a boost ring to vertices
-  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, std::vector<Point3d>& allPoints, double tol)
+  std::vector<Point3d> verticesFromBoostRing(const BoostRing& ring, PointSnapper& snapper, double tol)
   {
     std::vector<Point3d> result;
 
@@ -588,7 +693,7 @@ namespace openstudio{
       Point3d point3d(ring[i].x(), ring[i].y(), 0.0);
 
       // try to combine points within tolerance
-      Point3d resultPoint = getCombinedPoint(point3d, allPoints, tol);
+      Point3d resultPoint = snapper.combine(point3d);
 
       // don't keep repeated vertices
       if ((i > 0) && (result.back() == resultPoint)){
@@ -626,6 +731,152 @@ namespace openstudio{
     }
   };
 
+  // intersect two rings whose points were combined by snapper
+  boost::optional<IntersectionResult> intersectRings(const BoostRing& boostPolygon1, const BoostRing& boostPolygon2, PointSnapper& snapper, double tol)
+  {
+    std::vector<Point3d> resultPolygon1;
+    std::vector<Point3d> resultPolygon2;
+    std::vector< std::vector<Point3d> > newPolygons1;
+    std::vector< std::vector<Point3d> > newPolygons2;
+
+    // intersect the points in face coordinates,
+    std::vector<BoostPolygon> intersectionResult;
+    try{
+      boost::geometry::intersection(boostPolygon1, boostPolygon2, intersectionResult);
+    }catch(const boost::geometry::overlay_invalid_input_exception&){
+      LOG_FREE(Error, "utilities.geometry.intersect", "overlay_invalid_input_exception");
+      return boost::none;
+    }
+
+    // check if intersection is empty
+    if (intersectionResult.empty()){
+      //LOG_FREE(Info, "utilities.geometry.intersect", "Intersection is empty");
+      return boost::none;
+    }
+
+    intersectionResult = removeSpikes(intersectionResult);
+    intersectionResult = removeHoles(intersectionResult);
+
+    // check for multiple intersections
+    if (intersectionResult.size() > 1){
+      LOG_FREE(Info, "utilities.geometry.intersect", "Intersection has " << intersectionResult.size() << " elements");
+      std::sort(intersectionResult.begin(), intersectionResult.end(), BoostPolygonAreaGreater());
+    }
+
+    // check that largest intersection is ok
+    std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], snapper, tol);
+    boost::optional<double> testArea = boost::geometry::area(intersectionResult[0]);
+    if (!testArea || intersectionVertices.empty()){
+      LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of largest intersection");
+      return boost::none;
+    }else if (*testArea < tol*tol){
+      LOG_FREE(Info, "utilities.geometry.intersect", "Largest intersection has very small area of " << *testArea << " m^2");
+      return boost::none;
+    }
+    try{
+      boost::geometry::detail::overlay::has_self_intersections(intersectionResult[0]);
+    }catch(const boost::geometry::overlay_invalid_input_exception&){
+      LOG_FREE(Error, "utilities.geometry.intersect", "Largest intersection is self intersecting");
+      return boost::none;
+    }
+    if (!intersectionResult[0].inners().empty()){
+      LOG_FREE(Error, "utilities.geometry.intersect", "Largest intersection has inner loops");
+      return boost::none;
+    };
+
+    // intersections are the same
+    resultPolygon1 = intersectionVertices;
+    resultPolygon2 = intersectionVertices;
+
+    // create new polygon for each remaining intersection
+    for (unsigned i = 1; i < intersectionResult.size(); ++i){
+
+      std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], snapper, tol);
+
+      testArea = boost::geometry::area(intersectionResult[i]);
+      if (!testArea || newPolygon.empty()){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of intersection, result will not include this polygon, " << newPolygon);
+        continue;
+      }else if (*testArea < tol*tol){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Intersection has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon);
+        continue;
+      }
+      try{
+        boost::geometry::detail::overlay::has_self_intersections(intersectionResult[i]);
+      }catch(const boost::geometry::overlay_invalid_input_exception&){
+        LOG_FREE(Error, "utilities.geometry.intersect", "Intersection is self intersecting, result will not include this polygon, " << newPolygon);
+        continue;
+      }
+      if (!intersectionResult[i].inners().empty()){
+        LOG_FREE(Error, "utilities.geometry.intersect", "Intersection has inner loops, result will not include this polygon, " << newPolygon);
+        continue;
+      };
+
+      newPolygons1.push_back(newPolygon);
+      newPolygons2.push_back(newPolygon);
+    }
+
+    // polygon1 minus polygon2
+    std::vector<BoostPolygon> differenceResult1;
+    boost::geometry::difference(boostPolygon1, boostPolygon2, differenceResult1);
+    differenceResult1 = removeSpikes(differenceResult1);
+    differenceResult1 = removeHoles(differenceResult1);
+
+    // create new polygon for each difference
+    for (unsigned i = 0; i < differenceResult1.size(); ++i){
+
+      std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], snapper, tol);
+
+      testArea = boost::geometry::area(differenceResult1[i]);
+      if (!testArea || newPolygon1.empty()){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of face difference, result will not include this polygon, " << newPolygon1);
+        continue;
+      }else if (*testArea < tol*tol){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Face difference has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon1);
+        continue;
+      }
+      try{
+        boost::geometry::detail::overlay::has_self_intersections(differenceResult1[i]);
+      }catch(const boost::geometry::overlay_invalid_input_exception&){
+        LOG_FREE(Error, "utilities.geometry.intersect", "Face difference is self intersecting, result will not include this polygon, " << newPolygon1);
+        continue;
+      }
+
+      newPolygons1.push_back(newPolygon1);
+    }
+
+    // polygon2 minus polygon1
+    std::vector<BoostPolygon> differenceResult2;
+    boost::geometry::difference(boostPolygon2, boostPolygon1, differenceResult2);
+    differenceResult2 = removeSpikes(differenceResult2);
+    differenceResult2 = removeHoles(differenceResult2);
+
+    // create new polygon for each difference
+    for (unsigned i = 0; i < differenceResult2.size(); ++i){
+
+      std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], snapper, tol);
+
+      testArea = boost::geometry::area(differenceResult2[i]);
+      if (!testArea || newPolygon2.empty()){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of face difference, result will not include this polygon, " << newPolygon2);
+        continue;
+      }else if (*testArea < tol*tol){
+        LOG_FREE(Info, "utilities.geometry.intersect", "Face difference has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon2);
+        continue;
+      }
+      try{
+        boost::geometry::detail::overlay::has_self_intersections(differenceResult2[i]);
+      }catch(const boost::geometry::overlay_invalid_input_exception&){
+        LOG_FREE(Error, "utilities.geometry.intersect", "Face difference is self intersecting, result will not include this polygon, " << newPolygon2);
+        continue;
+      }
+
+      newPolygons2.push_back(newPolygon2);
+    }
+
+    return IntersectionResult(resultPolygon1, resultPolygon2, newPolygons1, newPolygons2);
+  }
+
   // Public functions
 
   IntersectionResult::IntersectionResult(const std::vector<Point3d>& polygon1,
@@ -659,16 +910,16 @@ namespace openstudio{
   std::vector<Point3d> removeSpikes(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostPolygon> boostPolygon = boostPolygonFromVertices(polygon, snapper, tol);
     if (!boostPolygon){
       return std::vector<Point3d>();
     }
 
     BoostPolygon boostResult = removeSpikes(*boostPolygon);
 
-    std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, allPoints, tol);
+    std::vector<Point3d> result = verticesFromBoostPolygon(boostResult, snapper, tol);
 
     return result;
   }
@@ -676,9 +927,9 @@ namespace openstudio{
   bool pointInPolygon(const Point3d& point, const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostRing> boostPolygon = nonIntersectingBoostRingFromVertices(polygon, snapper, tol);
     if (!boostPolygon){
       return false;
     }
@@ -687,7 +938,7 @@ namespace openstudio{
       return false;
     }
 
-    boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints, tol);
+    boost::tuple<double, double> p = boostPointFromPoint3d(point, snapper, tol);
     BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
     //boost::geometry::strategy::within::winding<BoostPoint> strategy;
@@ -709,14 +960,14 @@ namespace openstudio{
   boost::optional<std::vector<Point3d> > join(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, snapper, tol);
     if (!boostPolygon1){
       return boost::none;
     }
 
-    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
+    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, snapper, tol);
     if (!boostPolygon2){
       return boost::none;
     }
@@ -745,7 +996,7 @@ namespace openstudio{
       return boost::none;
     };
 
-    std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], allPoints, tol);
+    std::vector<Point3d> unionVertices = verticesFromBoostPolygon(unionResult[0], snapper, tol);
     boost::optional<double> testArea = boost::geometry::area(unionResult[0]);
     if (!testArea || unionVertices.empty()){
       LOG_FREE(Info, "utilities.geometry.join", "Cannot compute area of union");
@@ -812,160 +1063,69 @@ namespace openstudio{
 
   boost::optional<IntersectionResult> intersect(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
-    std::vector<Point3d> resultPolygon1;
-    std::vector<Point3d> resultPolygon2;
-    std::vector< std::vector<Point3d> > newPolygons1;
-    std::vector< std::vector<Point3d> > newPolygons2;
-
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, allPoints, tol);
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, snapper, tol);
     if (!boostPolygon1){
       return boost::none;
     }
 
-    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, allPoints, tol);
+    boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, snapper, tol);
     if (!boostPolygon2){
       return boost::none;
     }
 
-    // intersect the points in face coordinates,
-    std::vector<BoostPolygon> intersectionResult;
-    try{
-      boost::geometry::intersection(*boostPolygon1, *boostPolygon2, intersectionResult);
-    }catch(const boost::geometry::overlay_invalid_input_exception&){
-      LOG_FREE(Error, "utilities.geometry.intersect", "overlay_invalid_input_exception");
-      return boost::none;
-    }
+    return intersectRings(*boostPolygon1, *boostPolygon2, snapper, tol);
+  }
 
-    // check if intersection is empty
-    if (intersectionResult.empty()){
-      //LOG_FREE(Info, "utilities.geometry.intersect", "Intersection is empty");
-      return boost::none;
-    }
+  std::vector<boost::optional<IntersectionResult> > intersect(const std::vector<Point3d>& polygon1, const std::vector<std::vector<Point3d> >& polygons2, double tol)
+  {
+    std::vector<boost::optional<IntersectionResult> > result(polygons2.size());
 
-    intersectionResult = removeSpikes(intersectionResult);
-    intersectionResult = removeHoles(intersectionResult);
+    // polygon1 is converted first so its ring and points are the same for every pair,
+    // points added by each polygon2 are removed before converting the next one
+    PointSnapper snapper(tol);
 
-    // check for multiple intersections
-    if (intersectionResult.size() > 1){
-      LOG_FREE(Info, "utilities.geometry.intersect", "Intersection has " << intersectionResult.size() << " elements");
-      std::sort(intersectionResult.begin(), intersectionResult.end(), BoostPolygonAreaGreater());
+    boost::optional<BoostRing> boostPolygon1 = nonIntersectingBoostRingFromVertices(polygon1, snapper, tol);
+    if (!boostPolygon1){
+      return result;
     }
+    size_t numPoints1 = snapper.points().size();
 
-    // check that largest intersection is ok
-    std::vector<Point3d> intersectionVertices = verticesFromBoostPolygon(intersectionResult[0], allPoints, tol);
-    boost::optional<double> testArea = boost::geometry::area(intersectionResult[0]);
-    if (!testArea || intersectionVertices.empty()){
-      LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of largest intersection");
-      return boost::none;
-    }else if (*testArea < tol*tol){
-      LOG_FREE(Info, "utilities.geometry.intersect", "Largest intersection has very small area of " << *testArea << " m^2");
-      return boost::none;
-    }
-    try{
-      boost::geometry::detail::overlay::has_self_intersections(intersectionResult[0]);
-    }catch(const boost::geometry::overlay_invalid_input_exception&){
-      LOG_FREE(Error, "utilities.geometry.intersect", "Largest intersection is self intersecting");
-      return boost::none;
-    }
-    if (!intersectionResult[0].inners().empty()){
-      LOG_FREE(Error, "utilities.geometry.intersect", "Largest intersection has inner loops");
-      return boost::none;
-    };
+    // points only snap to within tol, polygons farther apart than that cannot intersect
+    BoostBox box1 = boost::geometry::return_envelope<BoostBox>(*boostPolygon1);
+    double margin = 2*tol;
 
-    // intersections are the same
-    resultPolygon1 = intersectionVertices;
-    resultPolygon2 = intersectionVertices;
-
-    // create new polygon for each remaining intersection
-    for (unsigned i = 1; i < intersectionResult.size(); ++i){
-
-      std::vector<Point3d> newPolygon = verticesFromBoostPolygon(intersectionResult[i], allPoints, tol);
-
-      testArea = boost::geometry::area(intersectionResult[i]);
-      if (!testArea || newPolygon.empty()){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of intersection, result will not include this polygon, " << newPolygon);
-        continue;
-      }else if (*testArea < tol*tol){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Intersection has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon);
-        continue;
-      }
-      try{
-        boost::geometry::detail::overlay::has_self_intersections(intersectionResult[i]);
-      }catch(const boost::geometry::overlay_invalid_input_exception&){
-        LOG_FREE(Error, "utilities.geometry.intersect", "Intersection is self intersecting, result will not include this polygon, " << newPolygon);
+    for (size_t i = 0; i < polygons2.size(); ++i){
+      const std::vector<Point3d>& polygon2 = polygons2[i];
+      if (polygon2.size() < 3){
         continue;
       }
-      if (!intersectionResult[i].inners().empty()){
-        LOG_FREE(Error, "utilities.geometry.intersect", "Intersection has inner loops, result will not include this polygon, " << newPolygon);
-        continue;
-      };
-
-      newPolygons1.push_back(newPolygon);
-      newPolygons2.push_back(newPolygon);
-    }
-
-    // polygon1 minus polygon2
-    std::vector<BoostPolygon> differenceResult1;
-    boost::geometry::difference(*boostPolygon1, *boostPolygon2, differenceResult1);
-    differenceResult1 = removeSpikes(differenceResult1);
-    differenceResult1 = removeHoles(differenceResult1);
 
-    // create new polygon for each difference
-    for (unsigned i = 0; i < differenceResult1.size(); ++i){
-
-      std::vector<Point3d> newPolygon1 = verticesFromBoostPolygon(differenceResult1[i], allPoints, tol);
-
-      testArea = boost::geometry::area(differenceResult1[i]);
-      if (!testArea || newPolygon1.empty()){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of face difference, result will not include this polygon, " << newPolygon1);
-        continue;
-      }else if (*testArea < tol*tol){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Face difference has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon1);
-        continue;
+      double minX = polygon2[0].x(), maxX = polygon2[0].x(), minY = polygon2[0].y(), maxY = polygon2[0].y();
+      for (const Point3d& point : polygon2){
+        minX = std::min(minX, point.x());
+        maxX = std::max(maxX, point.x());
+        minY = std::min(minY, point.y());
+        maxY = std::max(maxY, point.y());
       }
-      try{
-        boost::geometry::detail::overlay::has_self_intersections(differenceResult1[i]);
-      }catch(const boost::geometry::overlay_invalid_input_exception&){
-        LOG_FREE(Error, "utilities.geometry.intersect", "Face difference is self intersecting, result will not include this polygon, " << newPolygon1);
+      if ((minX > box1.max_corner().x() + margin) || (maxX < box1.min_corner().x() - margin) ||
+          (minY > box1.max_corner().y() + margin) || (maxY < box1.min_corner().y() - margin)){
         continue;
       }
 
-      newPolygons1.push_back(newPolygon1);
-    }
-
-    // polygon2 minus polygon1
-    std::vector<BoostPolygon> differenceResult2;
-    boost::geometry::difference(*boostPolygon2, *boostPolygon1, differenceResult2);
-    differenceResult2 = removeSpikes(differenceResult2);
-    differenceResult2 = removeHoles(differenceResult2);
-
-    // create new polygon for each difference
-    for (unsigned i = 0; i < differenceResult2.size(); ++i){
-
-      std::vector<Point3d> newPolygon2 = verticesFromBoostPolygon(differenceResult2[i], allPoints, tol);
+      snapper.truncate(numPoints1);
 
-      testArea = boost::geometry::area(differenceResult2[i]);
-      if (!testArea || newPolygon2.empty()){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Cannot compute area of face difference, result will not include this polygon, " << newPolygon2);
-        continue;
-      }else if (*testArea < tol*tol){
-        LOG_FREE(Info, "utilities.geometry.intersect", "Face difference has very small area of " << *testArea << " m^2, result will not include this polygon, " << newPolygon2);
-        continue;
-      }
-      try{
-        boost::geometry::detail::overlay::has_self_intersections(differenceResult2[i]);
-      }catch(const boost::geometry::overlay_invalid_input_exception&){
-        LOG_FREE(Error, "utilities.geometry.intersect", "Face difference is self intersecting, result will not include this polygon, " << newPolygon2);
+      boost::optional<BoostRing> boostPolygon2 = nonIntersectingBoostRingFromVertices(polygon2, snapper, tol);
+      if (!boostPolygon2){
         continue;
       }
 
-      newPolygons2.push_back(newPolygon2);
+      result[i] = intersectRings(*boostPolygon1, *boostPolygon2, snapper, tol);
     }
 
-    return IntersectionResult(resultPolygon1, resultPolygon2, newPolygons1, newPolygons2);
+    return result;
   }
 
   std::vector<std::vector<Point3d> > subtract(const std::vector<Point3d>& polygon, const std::vector<std::vector<Point3d> >& holes, double tol)
@@ -973,9 +1133,9 @@ namespace openstudio{
     std::vector<std::vector<Point3d> > result;
 
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostPolygon> initialBoostPolygon = nonIntersectingBoostPolygonFromVertices(polygon, snapper, tol);
     if (!initialBoostPolygon){
       return result;
     }
@@ -985,7 +1145,7 @@ namespace openstudio{
 
     std::vector<BoostPolygon> newBoostPolygons;
     for (const std::vector<Point3d>& hole : holes){
-      boost::optional<BoostPolygon> boostHole = nonIntersectingBoostPolygonFromVertices(hole, allPoints, tol);
+      boost::optional<BoostPolygon> boostHole = nonIntersectingBoostPolygonFromVertices(hole, snapper, tol);
       if (!boostHole){
         return result;
       }
@@ -1001,7 +1161,7 @@ namespace openstudio{
     }
 
     for (const BoostPolygon& boostPolygon : boostPolygons){
-      result.push_back(verticesFromBoostPolygon(boostPolygon, allPoints, tol));
+      result.push_back(verticesFromBoostPolygon(boostPolygon, snapper, tol));
     }
 
     return result;
@@ -1010,9 +1170,9 @@ namespace openstudio{
   bool selfIntersects(const std::vector<Point3d>& polygon, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, allPoints, tol);
+    boost::optional<BoostPolygon> bp = nonIntersectingBoostPolygonFromVertices(polygon, snapper, tol);
     if (bp){
       // able to get a non intersecting polygon, so does not self intersect
       return false;
@@ -1023,10 +1183,10 @@ namespace openstudio{
   bool intersects(const std::vector<Point3d>& polygon1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
-    boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, allPoints, tol);
-    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
+    boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(polygon1, snapper, tol);
+    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, snapper, tol);
 
     if (bp1 && bp2){
       return boost::geometry::intersects(*bp1, *bp2);
@@ -1045,17 +1205,17 @@ namespace openstudio{
   bool within(const std::vector<Point3d>& geometry1, const std::vector<Point3d>& polygon2, double tol)
   {
     // convert vertices to boost rings
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
     if (geometry1.size() == 1){
       if (geometry1[0].z() > tol){
         return false;
       }
 
-      boost::tuple<double, double> p = boostPointFromPoint3d(geometry1[0], allPoints, tol);
+      boost::tuple<double, double> p = boostPointFromPoint3d(geometry1[0], snapper, tol);
       BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
-      boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
+      boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, snapper, tol);
 
       if (bp2){
         return boost::geometry::within(boostPoint, *bp2);
@@ -1066,8 +1226,8 @@ namespace openstudio{
 
     /*
     // DLM: this is the better implementation, requires boost 1.57
-    boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(geometry1, allPoints, tol);
-    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
+    boost::optional<BoostPolygon> bp1 = boostPolygonFromVertices(geometry1, snapper, tol);
+    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, snapper, tol);
     if (bp1 && bp2){
       return boost::geometry::within(*bp1, *bp2);
     }
@@ -1077,11 +1237,11 @@ namespace openstudio{
     if (geometry1.size() < 3){
       return false;
     }
-    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, allPoints, tol);
+    boost::optional<BoostPolygon> bp2 = boostPolygonFromVertices(polygon2, snapper, tol);
     if (bp2){
       for (const Point3d& point : geometry1)
       {
-        boost::tuple<double, double> p = boostPointFromPoint3d(point, allPoints, tol);
+        boost::tuple<double, double> p = boostPointFromPoint3d(point, snapper, tol);
         BoostPoint boostPoint(p.get<0>(), p.get<1>());
 
         if (!boost::geometry::within(boostPoint, *bp2)){
@@ -1134,7 +1294,7 @@ namespace openstudio{
 
   std::vector<Point3d> simplify(const std::vector<Point3d>& vertices, bool removeCollinear, double tol)
   {
-    std::vector<Point3d> allPoints;
+    PointSnapper snapper(tol);
 
     bool reversed = false;
     boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
@@ -1146,9 +1306,9 @@ namespace openstudio{
 
     boost::optional<BoostPolygon> bp;
     if (reversed){
-      bp = boostPolygonFromVertices(reorderULC(reverse(vertices)), allPoints, tol);
+      bp = boostPolygonFromVertices(reorderULC(reverse(vertices)), snapper, tol);
     } else {
-      bp = boostPolygonFromVertices(reorderULC(vertices), allPoints, tol);
+      bp = boostPolygonFromVertices(reorderULC(vertices), snapper, tol);
     }
 
     if (!bp){
@@ -1164,7 +1324,8 @@ namespace openstudio{
     //boost::geometry::simplify(*bp, out, 0.0);
     boost::geometry::simplify(*bp, out, tol); // points within tol would already be merged
 
-    std::vector<Point3d> tmp = verticesFromBoostPolygon(out, allPoints, tol);
+    std::vector<Point3d> tmp = verticesFromBoostPolygon(out, snapper, tol);
+    const std::vector<Point3d>& allPoints = snapper.points();
 
     if (reversed){
       tmp = reorderULC(reverse(tmp));
@@ -78,7 +78,11 @@ namespace openstudio{
   private:
 
     REGISTER_LOGGER("utilities.Point3d");
-    Vector m_storage;
+
+    // coordinates are stored inline so that points can be created and copied without allocating
+    double m_x;
+    double m_y;
+    double m_z;
 
   };
 
@@ -0,0 +1,255 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "PolygonSet.hpp"
+#include "Point3d.hpp"
+#include "Vector3d.hpp"
+#include "Transformation.hpp"
+#include "../core/Assert.hpp"
+
+#include <cmath>
+
+namespace openstudio{
+
+  PolygonSet::PolygonSet()
+    : m_offsets(1, 0)
+  {}
+
+  PolygonSet::PolygonSet(const std::vector<std::vector<Point3d> >& polygons)
+    : m_offsets(1, 0)
+  {
+    unsigned n = 0;
+    for (const std::vector<Point3d>& polygon : polygons){
+      n += polygon.size();
+    }
+    reserve(polygons.size(), n);
+
+    for (const std::vector<Point3d>& polygon : polygons){
+      addPolygon(polygon);
+    }
+  }
+
+  void PolygonSet::reserve(unsigned numPolygons, unsigned numVertices)
+  {
+    m_xs.reserve(numVertices);
+    m_ys.reserve(numVertices);
+    m_zs.reserve(numVertices);
+    m_offsets.reserve(numPolygons + 1);
+  }
+
+  unsigned PolygonSet::addPolygon(const std::vector<Point3d>& vertices)
+  {
+    for (const Point3d& vertex : vertices){
+      m_xs.push_back(vertex.x());
+      m_ys.push_back(vertex.y());
+      m_zs.push_back(vertex.z());
+    }
+    m_offsets.push_back(m_xs.size());
+    return m_offsets.size() - 2;
+  }
+
+  unsigned PolygonSet::numPolygons() const
+  {
+    return m_offsets.size() - 1;
+  }
+
+  unsigned PolygonSet::numVertices() const
+  {
+    return m_xs.size();
+  }
+
+  unsigned PolygonSet::numVertices(unsigned i) const
+  {
+    OS_ASSERT(i < numPolygons());
+    return m_offsets[i+1] - m_offsets[i];
+  }
+
+  std::vector<Point3d> PolygonSet::vertices(unsigned i) const
+  {
+    OS_ASSERT(i < numPolygons());
+
+    std::vector<Point3d> result;
+    result.reserve(m_offsets[i+1] - m_offsets[i]);
+    for (unsigned j = m_offsets[i]; j < m_offsets[i+1]; ++j){
+      result.push_back(Point3d(m_xs[j], m_ys[j], m_zs[j]));
+    }
+    return result;
+  }
+
+  std::vector<std::vector<Point3d> > PolygonSet::polygons() const
+  {
+    std::vector<std::vector<Point3d> > result;
+    unsigned n = numPolygons();
+    result.reserve(n);
+    for (unsigned i = 0; i < n; ++i){
+      result.push_back(vertices(i));
+    }
+    return result;
+  }
+
+  const std::vector<double>& PolygonSet::xs() const
+  {
+    return m_xs;
+  }
+
+  const std::vector<double>& PolygonSet::ys() const
+  {
+    return m_ys;
+  }
+
+  const std::vector<double>& PolygonSet::zs() const
+  {
+    return m_zs;
+  }
+
+  const std::vector<unsigned>& PolygonSet::offsets() const
+  {
+    return m_offsets;
+  }
+
+  void PolygonSet::transform(const Transformation& transformation)
+  {
+    transformation.transformPoints(m_xs, m_ys, m_zs);
+  }
+
+  bool PolygonSet::newall(unsigned i, double& nx, double& ny, double& nz) const
+  {
+    nx = 0.0;
+    ny = 0.0;
+    nz = 0.0;
+
+    unsigned begin = m_offsets[i];
+    unsigned end = m_offsets[i+1];
+    if (end - begin < 3){
+      return false;
+    }
+
+    // same fan of cross products about the first vertex as getNewallVector
+    const double x0 = m_xs[begin];
+    const double y0 = m_ys[begin];
+    const double z0 = m_zs[begin];
+    for (unsigned j = begin + 1; j < end - 1; ++j){
+      double ax = m_xs[j] - x0;
+      double ay = m_ys[j] - y0;
+      double az = m_zs[j] - z0;
+      double bx = m_xs[j+1] - x0;
+      double by = m_ys[j+1] - y0;
+      double bz = m_zs[j+1] - z0;
+      nx += ay*bz - az*by;
+      ny += az*bx - ax*bz;
+      nz += ax*by - ay*bx;
+    }
+    return true;
+  }
+
+  std::vector<boost::optional<Vector3d> > PolygonSet::newallVectors() const
+  {
+    unsigned n = numPolygons();
+    std::vector<boost::optional<Vector3d> > result(n);
+    double nx, ny, nz;
+    for (unsigned i = 0; i < n; ++i){
+      if (newall(i, nx, ny, nz)){
+        result[i] = Vector3d(nx, ny, nz);
+      }
+    }
+    return result;
+  }
+
+  std::vector<boost::optional<Vector3d> > PolygonSet::outwardNormals() const
+  {
+    unsigned n = numPolygons();
+    std::vector<boost::optional<Vector3d> > result(n);
+    double nx, ny, nz;
+    for (unsigned i = 0; i < n; ++i){
+      if (newall(i, nx, ny, nz)){
+        Vector3d normal(nx, ny, nz);
+        if (normal.normalize()){
+          result[i] = normal;
+        }
+      }
+    }
+    return result;
+  }
+
+  std::vector<boost::optional<double> > PolygonSet::areas() const
+  {
+    unsigned n = numPolygons();
+    std::vector<boost::optional<double> > result(n);
+    double nx, ny, nz;
+    for (unsigned i = 0; i < n; ++i){
+      if (newall(i, nx, ny, nz)){
+        result[i] = std::sqrt(nx*nx + ny*ny + nz*nz) / 2.0;
+      }
+    }
+    return result;
+  }
+
+  std::vector<boost::optional<Point3d> > PolygonSet::centroids() const
+  {
+    unsigned n = numPolygons();
+    std::vector<boost::optional<Point3d> > result(n);
+    double nx, ny, nz;
+    for (unsigned i = 0; i < n; ++i){
+      if (!newall(i, nx, ny, nz)){
+        continue;
+      }
+
+      // weight the centroid of each triangle in the fan by its area projected onto the Newall vector,
+      // this equals the planar centroid without first transforming to face coordinates
+      unsigned begin = m_offsets[i];
+      unsigned end = m_offsets[i+1];
+      const double x0 = m_xs[begin];
+      const double y0 = m_ys[begin];
+      const double z0 = m_zs[begin];
+      double A = 0;
+      double cx = 0;
+      double cy = 0;
+      double cz = 0;
+      for (unsigned j = begin + 1; j < end - 1; ++j){
+        double ax = m_xs[j] - x0;
+        double ay = m_ys[j] - y0;
+        double az = m_zs[j] - z0;
+        double bx = m_xs[j+1] - x0;
+        double by = m_ys[j+1] - y0;
+        double bz = m_zs[j+1] - z0;
+        double dA = nx*(ay*bz - az*by) + ny*(az*bx - ax*bz) + nz*(ax*by - ay*bx);
+        A += dA;
+        cx += (ax + bx)*dA;
+        cy += (ay + by)*dA;
+        cz += (az + bz)*dA;
+      }
+
+      if (A > 0){
+        result[i] = Point3d(x0 + cx/(3.0*A), y0 + cy/(3.0*A), z0 + cz/(3.0*A));
+      }
+    }
+    return result;
+  }
+
+} // openstudio
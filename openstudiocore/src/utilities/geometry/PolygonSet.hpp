@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_POLYGONSET_HPP
+#define UTILITIES_GEOMETRY_POLYGONSET_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../core/Logger.hpp"
+
+#include <vector>
+#include <boost/optional.hpp>
+
+namespace openstudio{
+
+  // forward declaration
+  class Point3d;
+  class Vector3d;
+  class Transformation;
+
+  /** PolygonSet stores many polygons with their vertex coordinates packed into separate contiguous
+   *  x, y and z arrays.  It is intended for bulk geometry work (e.g. transforming or computing areas
+   *  of every surface in a model) where building a std::vector<Point3d> per polygon would dominate.
+   *  Results of the batch methods match the corresponding free functions in Geometry.hpp. */
+  class UTILITIES_API PolygonSet{
+  public:
+
+    /// default constructor creates an empty set
+    PolygonSet();
+
+    /// constructor from a vector of polygons
+    PolygonSet(const std::vector<std::vector<Point3d> >& polygons);
+
+    /// reserve space for the given number of polygons and vertices
+    void reserve(unsigned numPolygons, unsigned numVertices);
+
+    /// add a polygon, returns index of the new polygon
+    unsigned addPolygon(const std::vector<Point3d>& vertices);
+
+    /// number of polygons in the set
+    unsigned numPolygons() const;
+
+    /// total number of vertices in the set
+    unsigned numVertices() const;
+
+    /// number of vertices in polygon i
+    unsigned numVertices(unsigned i) const;
+
+    /// get the vertices of polygon i, asserts i is in range
+    std::vector<Point3d> vertices(unsigned i) const;
+
+    /// get the vertices of all polygons
+    std::vector<std::vector<Point3d> > polygons() const;
+
+    /// packed x coordinates of all vertices
+    const std::vector<double>& xs() const;
+
+    /// packed y coordinates of all vertices
+    const std::vector<double>& ys() const;
+
+    /// packed z coordinates of all vertices
+    const std::vector<double>& zs() const;
+
+    /// offset of the first vertex of each polygon in the packed arrays, has numPolygons()+1 entries
+    const std::vector<unsigned>& offsets() const;
+
+    /// apply the transformation to all vertices in place
+    void transform(const Transformation& transformation);
+
+    /// compute Newall vector for each polygon, empty if polygon has fewer than 3 vertices
+    std::vector<boost::optional<Vector3d> > newallVectors() const;
+
+    /// compute outward normal for each polygon, empty if it cannot be computed
+    std::vector<boost::optional<Vector3d> > outwardNormals() const;
+
+    /// compute area for each polygon, empty if polygon has fewer than 3 vertices
+    std::vector<boost::optional<double> > areas() const;
+
+    /// compute centroid for each polygon, empty if polygon has fewer than 3 vertices or zero area
+    std::vector<boost::optional<Point3d> > centroids() const;
+
+  private:
+
+    REGISTER_LOGGER("utilities.PolygonSet");
+
+    // Newall vector of polygon i, returns false if polygon has fewer than 3 vertices
+    bool newall(unsigned i, double& nx, double& ny, double& nz) const;
+
+    std::vector<double> m_xs;
+    std::vector<double> m_ys;
+    std::vector<double> m_zs;
+    std::vector<unsigned> m_offsets;
+  };
+
+} // openstudio
+
+#endif //UTILITIES_GEOMETRY_POLYGONSET_HPP
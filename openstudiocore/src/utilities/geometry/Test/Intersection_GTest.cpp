@@ -585,6 +585,45 @@ TEST_F(GeometryFixture, Intersect_Within_Up)
   EXPECT_FALSE(test);
 }
 
+TEST_F(GeometryFixture, Intersect_Batch)
+{
+  double tol = 0.01;
+
+  Point3dVector points1 = makeRectangleDown(0, 0, 2, 1);
+
+  std::vector<Point3dVector> others;
+  others.push_back(makeRectangleDown(1, 0, 2, 1)); // overlap
+  others.push_back(makeRectangleDown(10, 10, 1, 1)); // far away
+  others.push_back(makeRectangleDown(2, 0, 1, 1)); // adjacent
+  others.push_back(makeRectangleDown(0.5, 0.25, 1, 0.5)); // within
+  others.push_back(makeRectangleDown(0.004, 0.004, 1.996, 0.992)); // same as points1 after points are combined
+  others.push_back(makeRectangleUp(1, 0, 2, 1)); // wrong sense
+
+  std::vector<boost::optional<IntersectionResult> > tests = intersect(points1, others, tol);
+  ASSERT_EQ(others.size(), tests.size());
+
+  for (unsigned i = 0; i < others.size(); ++i){
+    boost::optional<IntersectionResult> test = intersect(points1, others[i], tol);
+    ASSERT_EQ(static_cast<bool>(test), static_cast<bool>(tests[i])) << i;
+    if (test){
+      EXPECT_EQ(test->polygon1(), tests[i]->polygon1()) << i;
+      EXPECT_EQ(test->polygon2(), tests[i]->polygon2()) << i;
+      EXPECT_EQ(test->newPolygons1(), tests[i]->newPolygons1()) << i;
+      EXPECT_EQ(test->newPolygons2(), tests[i]->newPolygons2()) << i;
+    }
+  }
+
+  EXPECT_TRUE(tests[0]);
+  EXPECT_FALSE(tests[1]);
+  EXPECT_FALSE(tests[2]);
+  EXPECT_TRUE(tests[3]);
+  ASSERT_TRUE(tests[4]);
+  EXPECT_TRUE(circularEqual(points1, tests[4]->polygon1())) << tests[4]->polygon1();
+  EXPECT_TRUE(tests[4]->newPolygons1().empty());
+  EXPECT_TRUE(tests[4]->newPolygons2().empty());
+  EXPECT_FALSE(tests[5]);
+}
+
 TEST_F(GeometryFixture, Join_False)
 {
   double tol = 0.01;
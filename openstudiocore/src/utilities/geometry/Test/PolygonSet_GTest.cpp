@@ -0,0 +1,156 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../PolygonSet.hpp"
+#include "../Geometry.hpp"
+#include "../Transformation.hpp"
+#include "../Point3d.hpp"
+#include "../Vector3d.hpp"
+
+using namespace std;
+using namespace boost;
+using namespace openstudio;
+
+TEST_F(GeometryFixture, PolygonSet)
+{
+  double tol = 1.0E-12;
+
+  std::vector<std::vector<Point3d> > polygons;
+
+  // floor, normal down
+  std::vector<Point3d> floor;
+  floor.push_back(Point3d(0,0,0));
+  floor.push_back(Point3d(0,10,0));
+  floor.push_back(Point3d(10,10,0));
+  floor.push_back(Point3d(10,0,0));
+  polygons.push_back(floor);
+
+  // L shaped wall
+  std::vector<Point3d> wall;
+  wall.push_back(Point3d(0,0,3));
+  wall.push_back(Point3d(0,0,0));
+  wall.push_back(Point3d(4,0,0));
+  wall.push_back(Point3d(4,0,1));
+  wall.push_back(Point3d(1,0,1));
+  wall.push_back(Point3d(1,0,3));
+  polygons.push_back(wall);
+
+  // tilted triangle
+  std::vector<Point3d> triangle;
+  triangle.push_back(Point3d(1,2,3));
+  triangle.push_back(Point3d(4,1,0));
+  triangle.push_back(Point3d(2,5,1));
+  polygons.push_back(triangle);
+
+  // degenerate polygons
+  std::vector<Point3d> line;
+  line.push_back(Point3d(0,0,0));
+  line.push_back(Point3d(1,1,1));
+  polygons.push_back(line);
+
+  std::vector<Point3d> collinear;
+  collinear.push_back(Point3d(0,0,0));
+  collinear.push_back(Point3d(1,1,1));
+  collinear.push_back(Point3d(2,2,2));
+  polygons.push_back(collinear);
+
+  PolygonSet polygonSet(polygons);
+  ASSERT_EQ(5u, polygonSet.numPolygons());
+  EXPECT_EQ(18u, polygonSet.numVertices());
+  EXPECT_EQ(6u, polygonSet.numVertices(1));
+  EXPECT_EQ(6u, polygonSet.offsets().size());
+  EXPECT_EQ(18u, polygonSet.xs().size());
+  EXPECT_TRUE(pointsEqual(wall, polygonSet.vertices(1)));
+
+  std::vector<boost::optional<Vector3d> > newalls = polygonSet.newallVectors();
+  std::vector<boost::optional<Vector3d> > normals = polygonSet.outwardNormals();
+  std::vector<boost::optional<double> > areas = polygonSet.areas();
+  std::vector<boost::optional<Point3d> > centroids = polygonSet.centroids();
+  ASSERT_EQ(5u, newalls.size());
+  ASSERT_EQ(5u, normals.size());
+  ASSERT_EQ(5u, areas.size());
+  ASSERT_EQ(5u, centroids.size());
+
+  for (unsigned i = 0; i < 5; ++i){
+    std::vector<Point3d> vertices = polygonSet.vertices(i);
+
+    boost::optional<Vector3d> newall = getNewallVector(vertices);
+    ASSERT_EQ(newall.is_initialized(), newalls[i].is_initialized());
+    if (newall){
+      EXPECT_EQ(*newall, *newalls[i]);
+    }
+
+    boost::optional<Vector3d> normal = getOutwardNormal(vertices);
+    ASSERT_EQ(normal.is_initialized(), normals[i].is_initialized());
+    if (normal){
+      EXPECT_TRUE(vectorEqual(*normal, *normals[i]));
+    }
+
+    boost::optional<double> area = getArea(vertices);
+    ASSERT_EQ(area.is_initialized(), areas[i].is_initialized());
+    if (area){
+      EXPECT_NEAR(*area, *areas[i], tol);
+    }
+
+    boost::optional<Point3d> centroid = getCentroid(vertices);
+    ASSERT_EQ(centroid.is_initialized(), centroids[i].is_initialized());
+    if (centroid){
+      EXPECT_NEAR(centroid->x(), centroids[i]->x(), 1.0E-9);
+      EXPECT_NEAR(centroid->y(), centroids[i]->y(), 1.0E-9);
+      EXPECT_NEAR(centroid->z(), centroids[i]->z(), 1.0E-9);
+    }
+  }
+
+  ASSERT_TRUE(areas[0]);
+  EXPECT_NEAR(100.0, *areas[0], tol);
+  ASSERT_TRUE(areas[1]);
+  EXPECT_NEAR(6.0, *areas[1], tol);
+  EXPECT_FALSE(areas[3]);
+  EXPECT_FALSE(centroids[4]);
+
+  // transform in place matches transforming each polygon
+  Transformation t = Transformation::translation(Vector3d(1,2,3)) * Transformation::rotation(Vector3d(1,1,1), degToRad(35));
+  polygonSet.transform(t);
+  for (unsigned i = 0; i < 5; ++i){
+    std::vector<Point3d> expected = t*polygons[i];
+    std::vector<Point3d> actual = polygonSet.vertices(i);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (unsigned j = 0; j < expected.size(); ++j){
+      EXPECT_EQ(expected[j], actual[j]);
+    }
+  }
+
+  // area is invariant under rigid transformation
+  areas = polygonSet.areas();
+  ASSERT_TRUE(areas[1]);
+  EXPECT_NEAR(6.0, *areas[1], 1.0E-9);
+}
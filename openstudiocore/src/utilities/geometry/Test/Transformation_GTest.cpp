@@ -595,3 +595,20 @@ TEST_F(GeometryFixture, Transformation_Decompose)
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << std::endl << test.matrix();
 
 }
+
+TEST_F(GeometryFixture, Transformation_VectorStorage)
+{
+  Transformation t = Transformation::translation(Vector3d(1,2,3)) * Transformation::rotation(Vector3d(0,1,1), degToRad(20));
+  Vector vector = t.vector();
+  ASSERT_EQ(16u, vector.size());
+
+  // round trip through column major vector representation
+  Transformation t2(vector);
+  Matrix m1 = t.matrix();
+  Matrix m2 = t2.matrix();
+  for (unsigned i = 0; i < 4; ++i){
+    for (unsigned j = 0; j < 4; ++j){
+      EXPECT_EQ(m1(i,j), m2(i,j));
+    }
+  }
+}
@@ -49,44 +49,54 @@ namespace openstudio{
 
   /// default constructor creates identity transformation
   Transformation::Transformation()
-    : m_storage(identity_matrix<double>(4))
-  {}
+  {
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        element(i,j) = (i == j) ? 1.0 : 0.0;
+      }
+    }
+  }
 
   /// copy constructor
   Transformation::Transformation(const Transformation& other)
-    : m_storage(other.m_storage)
-  {}
+  {
+    std::copy(other.m_storage, other.m_storage + 16, m_storage);
+  }
 
   /// constructor from storage, asserts matrix is 4x4
   Transformation::Transformation(const Matrix& matrix)
-    : m_storage(matrix)
   {
     OS_ASSERT(matrix.size1() == 4);
     OS_ASSERT(matrix.size2() == 4);
+
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        element(i,j) = matrix(i,j);
+      }
+    }
   }
 
   /// constructor from storage, asserts vector is size 16
   Transformation::Transformation(const Vector& vector)
-    : m_storage(Matrix(4,4))
   {
     OS_ASSERT(vector.size() == 16);
 
-    m_storage(0,0) = vector[0];
-    m_storage(1,0) = vector[1];
-    m_storage(2,0) = vector[2];
-    m_storage(3,0) = vector[3];
-    m_storage(0,1) = vector[4];
-    m_storage(1,1) = vector[5];
-    m_storage(2,1) = vector[6];
-    m_storage(2,1) = vector[7];
-    m_storage(0,2) = vector[8];
-    m_storage(1,2) = vector[9];
-    m_storage(2,2) = vector[10];
-    m_storage(3,2) = vector[11];
-    m_storage(0,3) = vector[12];
-    m_storage(1,3) = vector[13];
-    m_storage(2,3) = vector[14];
-    m_storage(3,3) = vector[15];
+    element(0,0) = vector[0];
+    element(1,0) = vector[1];
+    element(2,0) = vector[2];
+    element(3,0) = vector[3];
+    element(0,1) = vector[4];
+    element(1,1) = vector[5];
+    element(2,1) = vector[6];
+    element(3,1) = vector[7];
+    element(0,2) = vector[8];
+    element(1,2) = vector[9];
+    element(2,2) = vector[10];
+    element(3,2) = vector[11];
+    element(0,3) = vector[12];
+    element(1,3) = vector[13];
+    element(2,3) = vector[14];
+    element(3,3) = vector[15];
   }
 
   /// rotation about origin defined by axis and angle (radians)
@@ -237,7 +247,7 @@ namespace openstudio{
   Transformation Transformation::inverse() const
   {
     Matrix matrix(4,4);
-    bool test = invert(m_storage, matrix);
+    bool test = invert(this->matrix(), matrix);
     if (!test){
       // this should never happen
       LOG_AND_THROW("Matrix inversion failed");
@@ -248,29 +258,35 @@ namespace openstudio{
   /// get the matrix representation directly
   Matrix Transformation::matrix() const
   {
-    return m_storage;
+    Matrix result(4,4);
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        result(i,j) = element(i,j);
+      }
+    }
+    return result;
   }
 
   /// get the vector representation directly
   Vector Transformation::vector() const
   {
     openstudio::Vector result(16);
-    result[0] = m_storage(0,0);
-    result[1] = m_storage(1,0);
-    result[2] = m_storage(2,0);
-    result[3] = m_storage(3,0);
-    result[4] = m_storage(0,1);
-    result[5] = m_storage(1,1);
-    result[6] = m_storage(2,1);
-    result[7] = m_storage(3,1);
-    result[8] = m_storage(0,2);
-    result[9] = m_storage(1,2);
-    result[10] = m_storage(2,2);
-    result[11] = m_storage(3,2);
-    result[12] = m_storage(0,3);
-    result[13] = m_storage(1,3);
-    result[14] = m_storage(2,3);
-    result[15] = m_storage(3,3);
+    result[0] = element(0,0);
+    result[1] = element(1,0);
+    result[2] = element(2,0);
+    result[3] = element(3,0);
+    result[4] = element(0,1);
+    result[5] = element(1,1);
+    result[6] = element(2,1);
+    result[7] = element(3,1);
+    result[8] = element(0,2);
+    result[9] = element(1,2);
+    result[10] = element(2,2);
+    result[11] = element(3,2);
+    result[12] = element(0,3);
+    result[13] = element(1,3);
+    result[14] = element(2,3);
+    result[15] = element(3,3);
     return result;
   }
 
@@ -280,19 +296,19 @@ namespace openstudio{
     double psi;
     double theta;
     double phi;
-    if (m_storage(2,0) == 1.0){
+    if (element(2,0) == 1.0){
       phi = 0;
       theta = -boost::math::constants::pi<double>()/2.0;
-      psi = atan2(-m_storage(0,1), -m_storage(0,2));
-    }else if(m_storage(2,0) == -1.0){
+      psi = atan2(-element(0,1), -element(0,2));
+    }else if(element(2,0) == -1.0){
       phi = 0;
       theta = boost::math::constants::pi<double>()/2.0;
-      psi = atan2(m_storage(0,1), m_storage(0,2));
+      psi = atan2(element(0,1), element(0,2));
     }else{
-      theta = -asin(m_storage(2,0));
-      // theta = pi + asin(m_storage(2,0)); // alternate solution
-      psi = atan2(m_storage(2,1)/cos(theta), m_storage(2,2)/cos(theta));
-      phi = atan2(m_storage(1,0)/cos(theta), m_storage(0,0)/cos(theta));
+      theta = -asin(element(2,0));
+      // theta = pi + asin(element(2,0)); // alternate solution
+      psi = atan2(element(2,1)/cos(theta), element(2,2)/cos(theta));
+      phi = atan2(element(1,0)/cos(theta), element(0,0)/cos(theta));
 
     }
     EulerAngles result(psi, theta, phi);
@@ -305,7 +321,7 @@ namespace openstudio{
     Matrix result(3,3);
     for(unsigned i = 0 ; i < 3; ++i){
       for(unsigned j = 0; j < 3; ++j){
-        result(i,j) = m_storage(i,j);
+        result(i,j) = element(i,j);
       }
     }
     return result;
@@ -314,32 +330,31 @@ namespace openstudio{
   /// get the translation for the transformation, does not include rotation
   Vector3d Transformation::translation() const
   {
-    Vector3d result(m_storage(0, 3), m_storage(1, 3), m_storage(2, 3));
+    Vector3d result(element(0,3), element(1,3), element(2,3));
     return result;
   }
 
   /// apply the transformation to the point
   Point3d Transformation::operator*(const Point3d& point) const
   {
-    Vector temp(4);
-    temp(0) = point.x();
-    temp(1) = point.y();
-    temp(2) = point.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Point3d(temp[0], temp[1], temp[2]);
+    double x = point.x();
+    double y = point.y();
+    double z = point.z();
+    return Point3d(element(0,0)*x + element(0,1)*y + element(0,2)*z + element(0,3),
+                   element(1,0)*x + element(1,1)*y + element(1,2)*z + element(1,3),
+                   element(2,0)*x + element(2,1)*y + element(2,2)*z + element(2,3));
   }
 
   /// apply the transformation to the vector
   Vector3d Transformation::operator*(const Vector3d& vector) const
   {
-    Vector temp(4);
-    temp(0) = vector.x();
-    temp(1) = vector.y();
-    temp(2) = vector.z();
-    temp(3) = 1.0;
-    temp = prod(m_storage, temp);
-    return Vector3d(temp[0], temp[1], temp[2]);
+    // vectors are treated as homogeneous points, so translation is applied
+    double x = vector.x();
+    double y = vector.y();
+    double z = vector.z();
+    return Vector3d(element(0,0)*x + element(0,1)*y + element(0,2)*z + element(0,3),
+                    element(1,0)*x + element(1,1)*y + element(1,2)*z + element(1,3),
+                    element(2,0)*x + element(2,1)*y + element(2,2)*z + element(2,3));
   }
 
   /// apply the transformation to the BoundingBox
@@ -372,9 +387,10 @@ namespace openstudio{
   /// apply the transformation to a vector of points
   std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const
   {
-    std::vector<Point3d> result(points.size());
-    for(unsigned i = 0; i < points.size(); ++i){
-      result[i] = (*this)*points[i];
+    std::vector<Point3d> result;
+    result.reserve(points.size());
+    for (const Point3d& point : points){
+      result.push_back((*this)*point);
     }
     return result;
   }
@@ -382,9 +398,10 @@ namespace openstudio{
   /// apply the transformation to a vector of vector
   std::vector<Vector3d> Transformation::operator*(const std::vector<Vector3d>& vectors) const
   {
-    std::vector<Vector3d> result(vectors.size());
-    for(unsigned i = 0; i < vectors.size(); ++i){
-      result[i] = (*this)*vectors[i];
+    std::vector<Vector3d> result;
+    result.reserve(vectors.size());
+    for (const Vector3d& vector : vectors){
+      result.push_back((*this)*vector);
     }
     return result;
   }
@@ -392,7 +409,42 @@ namespace openstudio{
   /// apply the transformation to the other transformation
   Transformation Transformation::operator*(const Transformation& other) const
   {
-    return Transformation(prod(m_storage, other.m_storage));
+    Transformation result;
+    for (unsigned i = 0; i < 4; ++i){
+      for (unsigned j = 0; j < 4; ++j){
+        double sum = 0.0;
+        for (unsigned k = 0; k < 4; ++k){
+          sum += element(i,k)*other.element(k,j);
+        }
+        result.element(i,j) = sum;
+      }
+    }
+    return result;
+  }
+
+  /// apply the transformation in place to points stored as separate coordinate arrays
+  void Transformation::transformPoints(std::vector<double>& xs, std::vector<double>& ys, std::vector<double>& zs) const
+  {
+    OS_ASSERT(xs.size() == ys.size());
+    OS_ASSERT(xs.size() == zs.size());
+
+    const double a00 = element(0,0), a01 = element(0,1), a02 = element(0,2), a03 = element(0,3);
+    const double a10 = element(1,0), a11 = element(1,1), a12 = element(1,2), a13 = element(1,3);
+    const double a20 = element(2,0), a21 = element(2,1), a22 = element(2,2), a23 = element(2,3);
+
+    // simple loop over contiguous arrays so the compiler is free to vectorize it
+    double* x = xs.data();
+    double* y = ys.data();
+    double* z = zs.data();
+    const size_t n = xs.size();
+    for (size_t i = 0; i < n; ++i){
+      const double px = x[i];
+      const double py = y[i];
+      const double pz = z[i];
+      x[i] = a00*px + a01*py + a02*pz + a03;
+      y[i] = a10*px + a11*py + a12*pz + a13;
+      z[i] = a20*px + a21*py + a22*pz + a23;
+    }
   }
 
   /// ostream operator
@@ -123,10 +123,18 @@ namespace openstudio{
     /// apply the transformation to the other transformation
     Transformation operator*(const Transformation& other) const;
 
+    /// apply the transformation in place to points stored as separate coordinate arrays, asserts arrays are the same size
+    void transformPoints(std::vector<double>& xs, std::vector<double>& ys, std::vector<double>& zs) const;
+
   private:
 
     REGISTER_LOGGER("utilities.Transformation");
-    Matrix m_storage;
+
+    double& element(unsigned i, unsigned j) { return m_storage[4*i + j]; }
+    double element(unsigned i, unsigned j) const { return m_storage[4*i + j]; }
+
+    // 4x4 matrix stored inline in row major order, avoids a heap allocation per transformation
+    double m_storage[16];
 
   };
 
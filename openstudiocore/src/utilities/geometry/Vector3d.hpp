@@ -100,7 +100,10 @@ namespace openstudio{
 
     REGISTER_LOGGER("utilities.Vector3d");
 
-    Vector m_storage;
+    // coordinates are stored inline so that vectors can be created and copied without allocating
+    double m_x;
+    double m_y;
+    double m_z;
 
   };
 
@@ -41,6 +41,13 @@
 #include "../plot/ProgressBar.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Filesystem.hpp"
+#include "../core/Checksum.hpp"
+
+#include <OpenStudio.hxx>
+
+#include <sstream>
+#include <unordered_map>
 
 
 
@@ -519,10 +526,382 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
   return false;
 }
 
+namespace {
+
+  // Snapshot layout (all integers little-endian):
+  //   magic, format version, OpenStudio build, IddFileType, IDD version, checksum of the text
+  //   written by IdfFile::save, header, object count, one 16 byte handle per object, then for each object its IddObjectType
+  //   value, comment, tagged fields and field comments. Fields that hold the handle of an
+  //   object in the file are stored as an index into the handle table.
+  const char snapshotMagic[8] = {'O','S','S','N','A','P','\r','\n'};
+  const unsigned snapshotFormatVersion = 2;
+
+  enum SnapshotFieldTag {
+    StringField = 0,
+    EmptyField = 1,
+    HandleField = 2
+  };
+
+  void writeUInt(std::string& buffer, unsigned value) {
+    for (unsigned i = 0; i < 4; ++i) {
+      buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  void writeString(std::string& buffer, const std::string& value) {
+    writeUInt(buffer, static_cast<unsigned>(value.size()));
+    buffer.append(value);
+  }
+
+  /** Bounds checked reader over a snapshot that has been read into memory in one piece. */
+  class SnapshotReader {
+   public:
+    SnapshotReader(const std::string& buffer)
+      : m_buffer(buffer), m_pos(0), m_ok(true)
+    {}
+
+    bool ok() const { return m_ok; }
+
+    bool atEnd() const { return m_pos == m_buffer.size(); }
+
+    bool readMagic() {
+      if (!has(sizeof(snapshotMagic)) ||
+          (m_buffer.compare(m_pos, sizeof(snapshotMagic), snapshotMagic, sizeof(snapshotMagic)) != 0))
+      {
+        m_ok = false;
+        return false;
+      }
+      m_pos += sizeof(snapshotMagic);
+      return true;
+    }
+
+    unsigned readUInt() {
+      unsigned result(0);
+      if (!has(4)) {
+        return result;
+      }
+      for (unsigned i = 0; i < 4; ++i) {
+        result |= static_cast<unsigned>(static_cast<unsigned char>(m_buffer[m_pos + i])) << (8 * i);
+      }
+      m_pos += 4;
+      return result;
+    }
+
+    /** Reads a count of items that each take at least minBytes, failing if the rest of the
+     *  buffer is too short to hold them. */
+    unsigned readCount(unsigned minBytes) {
+      unsigned result = readUInt();
+      if (m_ok && (result > (m_buffer.size() - m_pos) / minBytes)) {
+        m_ok = false;
+        result = 0;
+      }
+      return result;
+    }
+
+    unsigned char readByte() {
+      if (!has(1)) {
+        return 0;
+      }
+      return static_cast<unsigned char>(m_buffer[m_pos++]);
+    }
+
+    std::string readString() {
+      unsigned n = readUInt();
+      if (!has(n)) {
+        return std::string();
+      }
+      std::string result(m_buffer, m_pos, n);
+      m_pos += n;
+      return result;
+    }
+
+    Handle readHandle() {
+      Handle result;
+      if (!has(16)) {
+        return result;
+      }
+      std::copy(m_buffer.begin() + m_pos, m_buffer.begin() + m_pos + 16, result.begin());
+      m_pos += 16;
+      return result;
+    }
+
+   private:
+    bool has(std::string::size_type n) {
+      if (m_ok && (m_buffer.size() - m_pos >= n)) {
+        return true;
+      }
+      m_ok = false;
+      return false;
+    }
+
+    const std::string& m_buffer;
+    std::string::size_type m_pos;
+    bool m_ok;
+  };
+
+}
+
+bool IdfFile::saveSnapshot(const openstudio::path& p, bool overwrite) const {
+  IddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
+  if (iddType == IddFileType::UserCustom) {
+    LOG(Warn,"Snapshots can only be saved for files that use an IddFileType known to the IddFactory.");
+    return false;
+  }
+
+  if (!overwrite && openstudio::filesystem::exists(p)) {
+    LOG(Info,"SaveSnapshot method failed because instructed not to overwrite path '"
+        << toString(p) << "'.");
+    return false;
+  }
+
+  std::string buffer;
+  buffer.append(snapshotMagic, sizeof(snapshotMagic));
+  writeUInt(buffer, snapshotFormatVersion);
+  writeString(buffer, openStudioLongVersion());
+  writeUInt(buffer, static_cast<unsigned>(iddType.value()));
+  writeString(buffer, version().str());
+
+  // lets loadCurrentSnapshot check that the text file still holds the same data
+  std::stringstream text;
+  print(text);
+  writeString(buffer, checksum(text));
+
+  writeString(buffer, m_header);
+
+  // handle table, and a lookup from handle string to table index for pointer fields
+  std::unordered_map<std::string, unsigned> handleIndices;
+  writeUInt(buffer, static_cast<unsigned>(m_objects.size()));
+  for (unsigned i = 0, n = m_objects.size(); i < n; ++i) {
+    Handle handle = m_objects[i].handle();
+    buffer.append(handle.begin(), handle.end());
+    handleIndices.insert(std::make_pair(toString(handle), i));
+  }
+
+  for (const IdfObject& object : m_objects) {
+    std::shared_ptr<detail::IdfObject_Impl> impl = object.getImpl<detail::IdfObject_Impl>();
+    writeUInt(buffer, static_cast<unsigned>(impl->m_iddObject.type().value()));
+    writeString(buffer, impl->m_comment);
+
+    writeUInt(buffer, static_cast<unsigned>(impl->m_fields.size()));
+    for (const std::string& field : impl->m_fields) {
+      if (field.empty()) {
+        buffer.push_back(static_cast<char>(EmptyField));
+        continue;
+      }
+      if ((field.size() == 38u) && (field[0] == '{')) {
+        auto it = handleIndices.find(field);
+        if (it != handleIndices.end()) {
+          buffer.push_back(static_cast<char>(HandleField));
+          writeUInt(buffer, it->second);
+          continue;
+        }
+      }
+      buffer.push_back(static_cast<char>(StringField));
+      writeString(buffer, field);
+    }
+
+    writeUInt(buffer, static_cast<unsigned>(impl->m_fieldComments.size()));
+    for (const std::string& fieldComment : impl->m_fieldComments) {
+      writeString(buffer, fieldComment);
+    }
+  }
+
+  if (makeParentFolder(p)) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary);
+    if (outFile) {
+      outFile.write(buffer.data(), buffer.size());
+      outFile.close();
+      if (outFile) {
+        return true;
+      }
+    }
+  }
+
+  LOG(Error,"Unable to write snapshot to path '" << toString(p) << "'.");
+  return false;
+}
+
+boost::optional<IdfFile> IdfFile::loadSnapshot(const openstudio::path& p) {
+  return m_loadSnapshot(p, boost::none);
+}
+
+openstudio::path IdfFile::snapshotPath(const openstudio::path& p) {
+  return toPath(toString(p) + ".snapshot");
+}
+
+boost::optional<IdfFile> IdfFile::loadCurrentSnapshot(const openstudio::path& p) {
+  path sp = snapshotPath(p);
+  try {
+    if (!openstudio::filesystem::exists(p) || !openstudio::filesystem::exists(sp)) {
+      return boost::none;
+    }
+  }
+  catch (...) {
+    return boost::none;
+  }
+
+  // reading p once is much cheaper than parsing it, and catches any change the file time would miss
+  return m_loadSnapshot(sp, checksum(p));
+}
+
+boost::optional<IdfFile> IdfFile::loadCurrentSnapshot(const openstudio::path& p,
+                                                      const IddFileType& iddFileType)
+{
+  OptionalIdfFile result = loadCurrentSnapshot(p);
+  if (result && (result->iddFileType() != iddFileType)) {
+    LOG(Warn,"Ignoring snapshot '" << toString(snapshotPath(p)) << "' because it does not hold "
+        << iddFileType.valueName() << " data.");
+    return boost::none;
+  }
+  return result;
+}
+
 // PRIVATE
 
 // SERIALIZATION
 
+boost::optional<IdfFile> IdfFile::m_loadSnapshot(const openstudio::path& p,
+                                                 const boost::optional<std::string>& textChecksum)
+{
+  // read the whole snapshot at once
+  std::string buffer;
+  {
+    openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+    if (!inFile) {
+      return boost::none;
+    }
+    inFile.seekg(0, std::ios_base::end);
+    std::streamoff size = inFile.tellg();
+    if (size <= 0) {
+      return boost::none;
+    }
+    buffer.resize(static_cast<std::string::size_type>(size));
+    inFile.seekg(0, std::ios_base::beg);
+    if (!inFile.read(&buffer[0], size)) {
+      LOG(Error,"Unable to read snapshot '" << toString(p) << "'.");
+      return boost::none;
+    }
+  }
+
+  SnapshotReader reader(buffer);
+  if (!reader.readMagic()) {
+    LOG(Warn,"File '" << toString(p) << "' is not an OpenStudio snapshot.");
+    return boost::none;
+  }
+
+  unsigned formatVersion = reader.readUInt();
+  std::string build = reader.readString();
+  if (!reader.ok() || (formatVersion != snapshotFormatVersion) || (build != openStudioLongVersion())) {
+    LOG(Info,"Snapshot '" << toString(p) << "' was written by a different build of OpenStudio, ignoring it.");
+    return boost::none;
+  }
+
+  int iddTypeValue = static_cast<int>(reader.readUInt());
+  std::string iddVersion = reader.readString();
+  if (!reader.ok() || (IddFileType::getValues().count(iddTypeValue) == 0u) ||
+      (IddFileType(iddTypeValue) == IddFileType::UserCustom))
+  {
+    LOG(Error,"Snapshot '" << toString(p) << "' has an invalid IddFileType.");
+    return boost::none;
+  }
+
+  IdfFile result{IddFileType(iddTypeValue)};
+  if (result.version().str() != iddVersion) {
+    LOG(Info,"Snapshot '" << toString(p) << "' was written with IDD version " << iddVersion
+        << ", ignoring it.");
+    return boost::none;
+  }
+
+  std::string snapshotTextChecksum = reader.readString();
+  if (!reader.ok()) {
+    LOG(Error,"Snapshot '" << toString(p) << "' is truncated or corrupt.");
+    return boost::none;
+  }
+  if (textChecksum && (*textChecksum != snapshotTextChecksum)) {
+    LOG(Info,"Snapshot '" << toString(p) << "' does not match the file it was saved for, ignoring it.");
+    return boost::none;
+  }
+
+  result.m_objects.clear();
+  result.m_versionObjectIndices.clear();
+  result.m_header = reader.readString();
+
+  unsigned numObjects = reader.readCount(16);
+  std::vector<Handle> handles;
+  for (unsigned i = 0; reader.ok() && (i < numObjects); ++i) {
+    handles.push_back(reader.readHandle());
+  }
+
+  // handles are printed once each, in case many fields point at the same object
+  std::vector<std::string> handleStrings(handles.size());
+
+  result.m_objects.reserve(handles.size());
+  for (unsigned i = 0; reader.ok() && (i < numObjects); ++i) {
+    int iddObjectTypeValue = static_cast<int>(reader.readUInt());
+    OptionalIddObject iddObject;
+    if (IddObjectType::getValues().count(iddObjectTypeValue) == 0u) {
+      // not a type in this build, reported below
+    }
+    else if (IddObjectType(iddObjectTypeValue) == IddObjectType::Catchall) {
+      iddObject = IddObject();
+    }
+    else {
+      iddObject = result.m_iddFileAndFactoryWrapper.getObject(IddObjectType(iddObjectTypeValue));
+    }
+    if (!iddObject) {
+      LOG(Error,"Snapshot '" << toString(p) << "' contains an object type that is not in its Idd.");
+      return boost::none;
+    }
+
+    std::string comment = reader.readString();
+
+    StringVector fields(reader.readCount(1));
+    for (std::string& field : fields) {
+      unsigned char tag = reader.readByte();
+      if (tag == StringField) {
+        field = reader.readString();
+      }
+      else if (tag == HandleField) {
+        unsigned index = reader.readUInt();
+        if (index >= handles.size()) {
+          LOG(Error,"Snapshot '" << toString(p) << "' contains an invalid handle reference.");
+          return boost::none;
+        }
+        if (handleStrings[index].empty()) {
+          handleStrings[index] = toString(handles[index]);
+        }
+        field = handleStrings[index];
+      }
+      else if (tag != EmptyField) {
+        LOG(Error,"Snapshot '" << toString(p) << "' is corrupt.");
+        return boost::none;
+      }
+      if (!reader.ok()) {
+        break;
+      }
+    }
+
+    StringVector fieldComments(reader.readCount(4));
+    for (std::string& fieldComment : fieldComments) {
+      fieldComment = reader.readString();
+    }
+
+    if (!reader.ok()) {
+      break;
+    }
+
+    result.addObject(IdfObject(std::make_shared<detail::IdfObject_Impl>(
+        handles[i], comment, *iddObject, fields, fieldComments)));
+  }
+
+  if (!reader.ok() || !reader.atEnd()) {
+    LOG(Error,"Snapshot '" << toString(p) << "' is truncated or corrupt.");
+    return boost::none;
+  }
+
+  return result;
+}
+
 bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnly) {
 
   int lineNum = 0;        // Idf line number
@@ -219,6 +219,33 @@ class UTILITIES_API IdfFile {
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Save this file to path p as a binary snapshot. A snapshot holds exactly the same data as the
+   *  text file written by save, but stores handles and handle-valued (pointer) fields in binary
+   *  form so that it can be loaded without parsing. It also records a checksum of that text, so
+   *  that loadCurrentSnapshot can tell whether a text file still matches it. Snapshots are tied
+   *  to the IDD version they were written with, and are not supported for IddFileType::UserCustom.
+   *  Will only overwrite an existing file if overwrite==true. Returns true if the save operation
+   *  is successful. */
+  bool saveSnapshot(const openstudio::path& p, bool overwrite=false) const;
+
+  /** Load an IdfFile from a binary snapshot written by saveSnapshot. Returns an empty optional if
+   *  the file is not a snapshot, is corrupt, or was written with a different IDD version. */
+  static boost::optional<IdfFile> loadSnapshot(const openstudio::path& p);
+
+  /** Returns the path where the snapshot that accompanies the text file at p is expected,
+   *  for instance, in.osm.snapshot for in.osm. */
+  static openstudio::path snapshotPath(const openstudio::path& p);
+
+  /** Loads snapshotPath(p) if it exists and was saved for the current contents of p, as checked
+   *  by the checksum of p. Used by loaders to skip parsing text files handed off between workflow
+   *  steps. */
+  static boost::optional<IdfFile> loadCurrentSnapshot(const openstudio::path& p);
+
+  /** Loads snapshotPath(p) if it exists, was saved for the current contents of p, and was
+   *  written for iddFileType. */
+  static boost::optional<IdfFile> loadCurrentSnapshot(const openstudio::path& p,
+                                                      const IddFileType& iddFileType);
+
   //@}
 
  protected:
@@ -247,6 +274,10 @@ class UTILITIES_API IdfFile {
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
 
+  /// private snapshot load function, rejects the snapshot if textChecksum does not match the one it records
+  static boost::optional<IdfFile> m_loadSnapshot(const openstudio::path& p,
+                                                 const boost::optional<std::string>& textChecksum);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
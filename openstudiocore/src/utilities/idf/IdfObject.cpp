@@ -51,6 +51,7 @@
 #include "../units/QuantityConverter.hpp"
 
 #include <boost/lexical_cast.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <iomanip>
 
@@ -1208,6 +1209,52 @@ namespace detail {
     return true;
   }
 
+  std::size_t IdfObject_Impl::dataFieldsHash() const {
+    std::size_t result = 0;
+    boost::hash_combine(result,m_iddObject.type().value());
+
+    OptionalUnsigned iName = m_iddObject.nameFieldIndex();
+
+    // must agree with dataFieldsEqual. the name field is skipped because it is ignored for objects
+    // with the same handle, and real values are skipped because they are compared with a tolerance.
+    for (unsigned i : dataFields()) {
+      boost::hash_combine(result,i);
+      if (iName && (i == iName.get())) {
+        continue;
+      }
+
+      OptionalIddField oIddField = m_iddObject.getField(i);
+      if (oIddField && (oIddField->properties().type == IddFieldType::IntegerType)) {
+        OptionalInt oIntValue = getInt(i);
+        if (oIntValue) {
+          boost::hash_combine(result,oIntValue.get());
+          continue;
+        }
+      }
+
+      if (oIddField && (oIddField->properties().type == IddFieldType::RealType)) {
+        if (getDouble(i)) {
+          continue;
+        }
+      }
+
+      if (oIddField && (oIddField->properties().type == IddFieldType::URLType)) {
+        if (getURL(i)) {
+          continue;
+        }
+      }
+
+      // strings (case-insensitive)
+      OptionalString oStringValue = getString(i);
+      OS_ASSERT(oStringValue);
+      for (char c : *oStringValue) {
+        boost::hash_combine(result,toupper(static_cast<unsigned char>(c)));
+      }
+    }
+
+    return result;
+  }
+
   bool IdfObject_Impl::objectListFieldsEqual(const IdfObject& other) const {
     if (m_iddObject != other.iddObject()) { return false; }
     UnsignedVector myFields = objectListFields();
@@ -2342,6 +2389,10 @@ bool IdfObject::dataFieldsEqual(const IdfObject& other) const {
   return m_impl->dataFieldsEqual(other);
 }
 
+std::size_t IdfObject::dataFieldsHash() const {
+  return m_impl->dataFieldsHash();
+}
+
 bool IdfObject::objectListFieldsEqual(const IdfObject& other) const {
   return m_impl->objectListFieldsEqual(other);
 }
@@ -331,6 +331,11 @@ class UTILITIES_API IdfObject {
    *  of name. */
   bool dataFieldsEqual(const IdfObject& other) const;
 
+  /** Returns a hash of the data (non-managedObjectList) fields that is consistent with
+   *  dataFieldsEqual, that is, objects whose data fields are equal have the same hash. The name
+   *  field and the values of real and url fields are not hashed. */
+  std::size_t dataFieldsHash() const;
+
   /** Checks for equality of objectListFields(). Prerequisite: iddObject()s must be
    *  equal. */
   bool objectListFieldsEqual(const IdfObject& other) const;
@@ -419,6 +424,7 @@ class UTILITIES_API IdfObject {
   friend class detail::Workspace_Impl;       // for finding IdfObjects in a workspace
   friend class WorkspaceObject;              // for WorkspaceObject::idfObject()
   friend class Workspace;                    // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                      // for IdfFile::loadSnapshot (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
@@ -50,6 +50,7 @@
 namespace openstudio {
 
 // forward declarations
+class IdfFile;
 class IdfObject;
 class IdfExtensibleGroup;
 struct IdfObjectImplLess;
@@ -324,6 +325,11 @@ namespace detail {
      *  of name. */
     bool dataFieldsEqual(const IdfObject& other) const;
 
+    /** Returns a hash of the data (non-managedObjectList) fields that is consistent with
+     *  dataFieldsEqual, that is, objects whose data fields are equal have the same hash. The name
+     *  field and the values of real and url fields are not hashed. */
+    std::size_t dataFieldsHash() const;
+
     /** Checks for equality of objectListFields(). Prerequisite: iddObject()s must be
      *  equal. */
     bool objectListFieldsEqual(const IdfObject& other) const;
@@ -395,6 +401,7 @@ namespace detail {
    protected:
 
     friend class openstudio::IdfObject;
+    friend class openstudio::IdfFile; // for snapshot serialization
 
     // handle
     Handle m_handle;
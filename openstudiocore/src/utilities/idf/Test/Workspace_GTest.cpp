@@ -48,6 +48,7 @@
 #include <utilities/idd/Zone_FieldEnums.hxx>
 #include <utilities/idd/Lights_FieldEnums.hxx>
 #include <utilities/idd/Output_Meter_FieldEnums.hxx>
+#include <utilities/idd/Output_Variable_FieldEnums.hxx>
 #include <utilities/idd/Schedule_Compact_FieldEnums.hxx>
 #include <utilities/idd/Wall_Exterior_FieldEnums.hxx>
 #include <utilities/idd/Wall_Adiabatic_FieldEnums.hxx>
@@ -55,6 +56,8 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/Sizing_Zone_FieldEnums.hxx>
 #include <utilities/idd/OS_WeatherFile_FieldEnums.hxx>
+#include <utilities/idd/AirflowNetwork_MultiZone_Surface_FieldEnums.hxx>
+#include <utilities/idd/AirflowNetwork_MultiZone_Component_ZoneExhaustFan_FieldEnums.hxx>
 #include "../WorkspaceWatcher.hpp"
 #include "IdfTestQObjects.hpp"
 
@@ -74,6 +77,7 @@
 
 using namespace openstudio;
 
+#include <cmath>
 #include <iostream>
 
 TEST_F(IdfFixture, IdfFile_Workspace_DefaultConstructor)
@@ -1483,6 +1487,56 @@ TEST_F(IdfFixture,Workspace_AddAndInsertWorkspaceObjects) {
   EXPECT_TRUE(result[1] == originalSchedule);
 }
 
+TEST_F(IdfFixture,Workspace_InsertUnnamedObjects) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  IdfObject variable(IddObjectType::Output_Variable);
+  EXPECT_TRUE(variable.setString(Output_VariableFields::KeyValue,"*"));
+  EXPECT_TRUE(variable.setString(Output_VariableFields::VariableName,"Zone Mean Air Temperature"));
+  EXPECT_TRUE(variable.setString(Output_VariableFields::ReportingFrequency,"Hourly"));
+  OptionalWorkspaceObject owo = ws.addObject(variable);
+  ASSERT_TRUE(owo);
+  WorkspaceObject original = *owo;
+  EXPECT_EQ(variable.dataFieldsHash(),original.dataFieldsHash());
+
+  // equivalent object found, strings compared case-insensitively
+  IdfObject sameVariable = variable.clone();
+  EXPECT_TRUE(sameVariable.setString(Output_VariableFields::VariableName,"zone mean air temperature"));
+  EXPECT_EQ(variable.dataFieldsHash(),sameVariable.dataFieldsHash());
+  WorkspaceObjectVector result = ws.insertObjects(IdfObjectVector(1u,sameVariable));
+  ASSERT_EQ(1u,result.size());
+  EXPECT_TRUE(result[0] == original);
+  EXPECT_EQ(1u,ws.numObjects());
+
+  // different data is added
+  IdfObject otherVariable = variable.clone();
+  EXPECT_TRUE(otherVariable.setString(Output_VariableFields::ReportingFrequency,"Timestep"));
+  result = ws.insertObjects(IdfObjectVector(1u,otherVariable));
+  ASSERT_EQ(1u,result.size());
+  EXPECT_FALSE(result[0] == original);
+  EXPECT_EQ(2u,ws.numObjects());
+
+  // edits are picked up by the next lookup
+  EXPECT_TRUE(original.setString(Output_VariableFields::ReportingFrequency,"Daily"));
+  result = ws.insertObjects(IdfObjectVector(1u,variable));
+  ASSERT_EQ(1u,result.size());
+  EXPECT_FALSE(result[0] == original);
+  EXPECT_EQ(3u,ws.numObjects());
+
+  EXPECT_TRUE(sameVariable.setString(Output_VariableFields::ReportingFrequency,"daily"));
+  result = ws.insertObjects(IdfObjectVector(1u,sameVariable));
+  ASSERT_EQ(1u,result.size());
+  EXPECT_TRUE(result[0] == original);
+  EXPECT_EQ(3u,ws.numObjects());
+
+  // removed objects are no longer found
+  EXPECT_TRUE(original.remove().size() > 0);
+  EXPECT_EQ(2u,ws.numObjects());
+  result = ws.insertObjects(IdfObjectVector(1u,sameVariable));
+  ASSERT_EQ(1u,result.size());
+  EXPECT_EQ(3u,ws.numObjects());
+}
+
 TEST_F(IdfFixture,Workspace_LocateURLs) {
   // DLM: replace with OS_WeatherFileFields
 
@@ -2157,3 +2211,105 @@ TEST_F(IdfFixture, Workspace_GetObjectsByNameUUID)
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", true).size());
   EXPECT_EQ(1u, ws.getObjectsByName("{af63d539-6e16-4fd1-a10e-dafe3793373b}", false).size());
 }
+
+TEST_F(IdfFixture, Workspace_GetDoublesByType)
+{
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  EXPECT_TRUE(ws.getDoublesByType(IddObjectType::Zone, ZoneFields::Multiplier).empty());
+
+  boost::optional<WorkspaceObject> zone1 = ws.addObject(IdfObject(IddObjectType::Zone));
+  boost::optional<WorkspaceObject> zone2 = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  EXPECT_TRUE(zone1->setDouble(ZoneFields::Multiplier, 3));
+
+  std::vector<WorkspaceObject> zones = ws.getObjectsByType(IddObjectType::Zone);
+  std::vector<double> multipliers = ws.getDoublesByType(IddObjectType::Zone, ZoneFields::Multiplier);
+  ASSERT_EQ(2u, zones.size());
+  ASSERT_EQ(2u, multipliers.size());
+
+  // same order as getObjectsByType, empty fields are NaN
+  for (unsigned i = 0; i < 2; ++i) {
+    if (zones[i] == *zone1) {
+      EXPECT_DOUBLE_EQ(3.0, multipliers[i]);
+    } else {
+      EXPECT_TRUE(std::isnan(multipliers[i]));
+    }
+  }
+}
+
+TEST_F(IdfFixture, Workspace_IncrementalValidityReport)
+{
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+
+  // enough objects that the first report is checked on several threads
+  IdfObjectVector idfObjects;
+  for (unsigned i = 0; i < 3000; ++i) {
+    IdfObject zone(IddObjectType::Zone);
+    zone.setName("Zone " + std::to_string(i));
+    idfObjects.push_back(zone);
+  }
+  WorkspaceObjectVector zones = workspace.addObjects(idfObjects);
+  ASSERT_EQ(3000u, zones.size());
+  EXPECT_TRUE(workspace.isValid(StrictnessLevel::Draft));
+
+  // later reports only re-check changed objects, and must still see the change
+  EXPECT_TRUE(zones[10].setInt(ZoneFields::Multiplier, 0));
+  EXPECT_FALSE(workspace.isValid(StrictnessLevel::Draft));
+  EXPECT_EQ(1u, workspace.validityReport(StrictnessLevel::Draft).numErrors());
+  EXPECT_TRUE(zones[10].setInt(ZoneFields::Multiplier, 2));
+  EXPECT_TRUE(workspace.isValid(StrictnessLevel::Draft));
+
+  // removing a target nulls the pointers to it, a clone is checked from scratch
+  OptionalWorkspaceObject lights = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(lights);
+  EXPECT_TRUE(lights->setPointer(LightsFields::ZoneorZoneListName, zones[0].handle()));
+  EXPECT_EQ(workspace.clone().validityReport(StrictnessLevel::Final).numErrors(),
+            workspace.validityReport(StrictnessLevel::Final).numErrors());
+  EXPECT_TRUE(workspace.removeObject(zones[0].handle()));
+  EXPECT_FALSE(lights->getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(workspace.clone().validityReport(StrictnessLevel::Final).numErrors(),
+            workspace.validityReport(StrictnessLevel::Final).numErrors());
+}
+
+TEST_F(IdfFixture, Workspace_IncrementalValidityReport_ForwardedReferences)
+{
+  Workspace workspace(StrictnessLevel::None, IddFileType::EnergyPlus);
+
+  OptionalWorkspaceObject fan = workspace.addObject(IdfObject(IddObjectType::Fan_ZoneExhaust));
+  ASSERT_TRUE(fan);
+  EXPECT_TRUE(fan->setName("Exhaust Fan"));
+
+  // the fan is only a surface leakage component while an airflow network object forwards it
+  OptionalWorkspaceObject surface = workspace.addObject(IdfObject(IddObjectType::AirflowNetwork_MultiZone_Surface));
+  ASSERT_TRUE(surface);
+  EXPECT_TRUE(surface->setPointer(AirflowNetwork_MultiZone_SurfaceFields::LeakageComponentName, fan->handle()));
+
+  auto surfaceErrors = [&]() {
+    unsigned result = 0;
+    ValidityReport report = workspace.validityReport(StrictnessLevel::Draft);
+    while (OptionalDataError error = report.nextError()) {
+      if (error->objectIdentifier() == surface->handle()) {
+        ++result;
+      }
+    }
+    return result;
+  };
+
+  unsigned numSurfaceErrors = surfaceErrors();
+  EXPECT_LT(0u, numSurfaceErrors);
+
+  // adding the forwarding object makes the surface pointer valid
+  OptionalWorkspaceObject exhaustFan = workspace.addObject(IdfObject(IddObjectType::AirflowNetwork_MultiZone_Component_ZoneExhaustFan));
+  ASSERT_TRUE(exhaustFan);
+  EXPECT_TRUE(exhaustFan->setPointer(AirflowNetwork_MultiZone_Component_ZoneExhaustFanFields::Name, fan->handle()));
+  EXPECT_EQ(numSurfaceErrors - 1, surfaceErrors());
+  EXPECT_EQ(workspace.clone().validityReport(StrictnessLevel::Draft).numErrors(),
+            workspace.validityReport(StrictnessLevel::Draft).numErrors());
+
+  // removing it makes the surface pointer invalid again
+  EXPECT_TRUE(workspace.removeObject(exhaustFan->handle()));
+  EXPECT_EQ(numSurfaceErrors, surfaceErrors());
+  EXPECT_EQ(workspace.clone().validityReport(StrictnessLevel::Draft).numErrors(),
+            workspace.validityReport(StrictnessLevel::Draft).numErrors());
+}
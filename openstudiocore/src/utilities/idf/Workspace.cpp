@@ -45,6 +45,10 @@
 
 #include <boost/lexical_cast.hpp>
 
+#include <exception>
+#include <limits>
+#include <thread>
+
 
 using namespace std;
 using openstudio::istringEqual; // used for all name comparisons
@@ -186,6 +190,9 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    m_dataFieldsHashIndexMap.swap(otherImpl->m_dataFieldsHashIndexMap);
+    m_validityCacheMap.swap(otherImpl->m_validityCacheMap);
   }
 
   // GETTERS
@@ -389,6 +396,18 @@ namespace detail {
     return result;
   }
 
+  std::vector<double> Workspace_Impl::getDoublesByType(IddObjectType objectType, unsigned index) const {
+    std::vector<double> result;
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if (loc == m_iddObjectTypeMap.end()) { return result; }
+    result.reserve(loc->second.size());
+    for( auto it = loc->second.begin(); it != loc->second.end(); ++it ) {
+      OptionalDouble value = it->second->getDouble(index);
+      result.push_back(value ? *value : std::numeric_limits<double>::quiet_NaN());
+    }
+    return result;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(
       IddObjectType objectType,const std::string& name) const
   {
@@ -1567,8 +1586,17 @@ namespace detail {
     // get reference lists and add targetHandle to them (ok if insert fails)
     OptionalIddField iddField = sourceObject.iddObject().getField(index);
     OS_ASSERT(iddField);
+    if (iddField->properties().references.empty()) {
+      return;
+    }
+    WorkspaceObject targetObject = *(getObject(targetHandle));
     for (const std::string& referenceName : iddField->properties().references) {
-      m_idfReferencesMap[referenceName].insert(std::make_pair(targetHandle,getObject(targetHandle)->getImpl<WorkspaceObject_Impl>()));
+      m_idfReferencesMap[referenceName].insert(std::make_pair(targetHandle,targetObject.getImpl<WorkspaceObject_Impl>()));
+    }
+
+    // other pointers to the target may have just become valid
+    for (const WorkspaceObject& otherSource : targetObject.sources()) {
+      registerValidityChange(otherSource.handle());
     }
   }
 
@@ -1620,6 +1648,11 @@ namespace detail {
           m_idfReferencesMap[referenceName].erase(it);
         }
       }
+
+      // the remaining pointers to the target may have just become invalid
+      for (const WorkspaceObject& sourceObject : sourceObjects) {
+        registerValidityChange(sourceObject.handle());
+      }
     }
   }
 
@@ -1735,9 +1768,8 @@ namespace detail {
   {
     ValidityReport report(level);
 
-    int i = 0;
     this->progressRange.nano_emit(0, static_cast<int>(numObjects()));
-    this->progressValue.nano_emit(i);
+    this->progressValue.nano_emit(0);
     this->progressCaption.nano_emit("Checking Validity");
 
     // StrictnessLevel::None
@@ -1748,6 +1780,11 @@ namespace detail {
     map<string,pair<bool,std::shared_ptr<WorkspaceObject_Impl> > > mapOfNames;
     map<string,list <std::shared_ptr<WorkspaceObject_Impl> > > objectsRepeatNames;
 
+    // object-level errors are cached per strictness level, only objects that were added or
+    // changed since the last report are checked again
+    ValidityCache& cache = m_validityCacheMap[level.value()];
+    std::vector<std::shared_ptr<WorkspaceObject_Impl> > objectsToCheck;
+
     // by-object items
     for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap)
     {
@@ -1783,31 +1820,26 @@ namespace detail {
         }
       }
 
-
-      // object-level report
-      ValidityReport objectReport = p.second->validityReport(level,false);
-      OptionalDataError oError = objectReport.nextError();
-      while (oError) {
-        report.insertError(*oError);
-        oError = objectReport.nextError();
+      if ((cache.dirtyHandles.find(p.first) != cache.dirtyHandles.end()) ||
+          (cache.errorsByHandle.find(p.first) == cache.errorsByHandle.end()))
+      {
+        objectsToCheck.push_back(p.second);
       }
+    }
 
-      // StrictnessLevel::Draft
-      if (level > StrictnessLevel::None) {
-        // DataErrorType::NoIdd
-        // object-level
-        if (iddFileType() == IddFileType::UserCustom) {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().name())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
-          }
-        }
-        else {
-          if (!m_iddFileAndFactoryWrapper.isInFile(p.second->iddObject().type())) {
-            report.insertError(DataError(WorkspaceObject(p.second),DataErrorType(DataErrorType::NoIdd)));
-          }
-        }
-      } // StrictnessLevel::Draft
+    // object-level report
+    std::vector<std::vector<DataError> > newErrors;
+    checkObjectValidity(objectsToCheck,level,newErrors);
+    for (unsigned j = 0, n = objectsToCheck.size(); j < n; ++j) {
+      cache.errorsByHandle[objectsToCheck[j]->handle()].swap(newErrors[j]);
+    }
+    cache.dirtyHandles.clear();
 
+    int i = 0;
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      for (const DataError& error : cache.errorsByHandle[p.first]) {
+        report.insertError(error);
+      }
       this->progressValue.nano_emit(++i);
     }
 
@@ -1892,6 +1924,10 @@ namespace detail {
     return toIdfFile().save(p,overwrite);
   }
 
+  bool Workspace_Impl::saveSnapshot(const openstudio::path& p, bool overwrite) {
+    return toIdfFile().saveSnapshot(p,overwrite);
+  }
+
   IdfFile Workspace_Impl::toIdfFile() {
 
     IdfFile result;
@@ -2005,7 +2041,7 @@ namespace detail {
       return versionObject();
     }
 
-    // get candidates by type and name
+    // get candidates by type and name, or by type and data field hash
     OptionalString oName = other.name();
     WorkspaceObjectVector candidates;
     if (oName && !oName->empty()) {
@@ -2013,7 +2049,13 @@ namespace detail {
       if (owo) { candidates.push_back(*owo); }
     }
     else {
-      candidates = getObjectsByType(other.iddObject().type());
+      const DataFieldsHashIndex& index = dataFieldsHashIndex(other.iddObject().type());
+      auto range = index.handlesByHash.equal_range(other.dataFieldsHash());
+      for (auto it = range.first; it != range.second; ++it) {
+        OptionalWorkspaceObject owo = getObject(it->second);
+        OS_ASSERT(owo);
+        candidates.push_back(*owo);
+      }
     }
 
     // test for equivalency
@@ -2039,17 +2081,162 @@ namespace detail {
     return result;
   }
 
+  const Workspace_Impl::DataFieldsHashIndex& Workspace_Impl::dataFieldsHashIndex(
+      IddObjectType type) const
+  {
+    auto loc = m_dataFieldsHashIndexMap.find(type);
+    if (loc == m_dataFieldsHashIndexMap.end()) {
+      // build index from all objects of this type
+      loc = m_dataFieldsHashIndexMap.insert(std::make_pair(type,DataFieldsHashIndex())).first;
+      auto iotmLoc = m_iddObjectTypeMap.find(type);
+      if (iotmLoc != m_iddObjectTypeMap.end()) {
+        for (const auto& p : iotmLoc->second) {
+          loc->second.staleHandles.insert(p.first);
+        }
+      }
+    }
+
+    // rehash objects added or edited since the last lookup
+    DataFieldsHashIndex& index = loc->second;
+    for (const Handle& handle : index.staleHandles) {
+      index.erase(handle);
+      auto objectLoc = m_workspaceObjectMap.find(handle);
+      if (objectLoc != m_workspaceObjectMap.end()) {
+        std::size_t hash = objectLoc->second->dataFieldsHash();
+        index.hashesByHandle.insert(std::make_pair(handle,hash));
+        index.handlesByHash.insert(std::make_pair(hash,handle));
+      }
+    }
+    index.staleHandles.clear();
+
+    return index;
+  }
+
+  void Workspace_Impl::registerDataFieldsChange(const Handle& handle, IddObjectType type) {
+    auto loc = m_dataFieldsHashIndexMap.find(type);
+    if (loc != m_dataFieldsHashIndexMap.end()) {
+      loc->second.staleHandles.insert(handle);
+    }
+  }
+
+  void Workspace_Impl::registerValidityChange(const Handle& handle) {
+    for (auto& p : m_validityCacheMap) {
+      p.second.dirtyHandles.insert(handle);
+    }
+  }
+
+  std::vector<DataError> Workspace_Impl::objectValidityErrors(const WorkspaceObject_Impl& object,
+                                                              StrictnessLevel level) const
+  {
+    std::vector<DataError> result;
+
+    ValidityReport objectReport = object.validityReport(level,false);
+    OptionalDataError oError = objectReport.nextError();
+    while (oError) {
+      result.push_back(*oError);
+      oError = objectReport.nextError();
+    }
+
+    // StrictnessLevel::Draft
+    if (level > StrictnessLevel::None) {
+      // DataErrorType::NoIdd
+      // object-level
+      bool inFile = (iddFileType() == IddFileType::UserCustom) ?
+                    m_iddFileAndFactoryWrapper.isInFile(object.iddObject().name()) :
+                    m_iddFileAndFactoryWrapper.isInFile(object.iddObject().type());
+      if (!inFile) {
+        result.push_back(DataError(object.getObject<WorkspaceObject>(),DataErrorType(DataErrorType::NoIdd)));
+      }
+    } // StrictnessLevel::Draft
+
+    return result;
+  }
+
+  void Workspace_Impl::checkObjectValidity(const std::vector<std::shared_ptr<WorkspaceObject_Impl> >& objects,
+                                           StrictnessLevel level,
+                                           std::vector<std::vector<DataError> >& errors) const
+  {
+    // below this many objects per thread, starting threads costs more than it saves
+    const unsigned minObjectsPerThread = 1000;
+
+    unsigned n = objects.size();
+    errors.clear();
+    errors.resize(n);
+
+    unsigned numThreads = std::min(std::max(std::thread::hardware_concurrency(), 1u), n / minObjectsPerThread);
+    if (numThreads < 2) {
+      for (unsigned i = 0; i < n; ++i) {
+        errors[i] = objectValidityErrors(*objects[i],level);
+      }
+      return;
+    }
+
+    // IddObject lazily caches its name field, fill those caches before sharing the objects
+    for (const auto& object : objects) {
+      object->iddObject().hasNameField();
+    }
+
+    // object-level checks only read the workspace, so each thread fills its own range of errors
+    std::vector<std::exception_ptr> exceptions(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+      unsigned begin = (n * t) / numThreads;
+      unsigned end = (n * (t + 1)) / numThreads;
+      threads.push_back(std::thread([this, &objects, &errors, &exceptions, level, begin, end, t]() {
+        try {
+          for (unsigned i = begin; i < end; ++i) {
+            errors[i] = objectValidityErrors(*objects[i],level);
+          }
+        }
+        catch (...) {
+          exceptions[t] = std::current_exception();
+        }
+      }));
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const std::exception_ptr& exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+  void Workspace_Impl::removeFromDataFieldsHashIndex(const Handle& handle, IddObjectType type) {
+    auto loc = m_dataFieldsHashIndexMap.find(type);
+    if (loc == m_dataFieldsHashIndexMap.end()) { return; }
+    loc->second.staleHandles.erase(handle);
+    loc->second.erase(handle);
+  }
+
+  void Workspace_Impl::DataFieldsHashIndex::erase(const Handle& handle) {
+    auto hashLoc = hashesByHandle.find(handle);
+    if (hashLoc == hashesByHandle.end()) { return; }
+    auto range = handlesByHash.equal_range(hashLoc->second);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == handle) {
+        handlesByHash.erase(it);
+        break;
+      }
+    }
+    hashesByHandle.erase(hashLoc);
+  }
+
   // SETTER HELPERS
 
   bool Workspace_Impl::setIddFile(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper) {
     IddFileAndFactoryWrapper temp = m_iddFileAndFactoryWrapper;
     m_iddFileAndFactoryWrapper = iddFileAndFactoryWrapper;
+    // NoIdd errors depend on the IddFile
+    m_validityCacheMap.clear();
     if (isValid()) { return true; }
     else {
       LOG(Warn,"Unable to set IddFile to IddFileType " << iddFileAndFactoryWrapper.iddFileType()
           << ". Resulting Workspace is not valid:" << std::endl
           << validityReport(m_strictnessLevel));
       m_iddFileAndFactoryWrapper = temp;
+      m_validityCacheMap.clear();
       return false;
     }
   }
@@ -2088,6 +2275,7 @@ namespace detail {
       const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr)
   {
     m_iddObjectTypeMap[objectImplPtr->iddObject().type()].insert(std::make_pair(objectImplPtr->handle(),objectImplPtr));
+    registerDataFieldsChange(objectImplPtr->handle(),objectImplPtr->iddObject().type());
   }
 
   void Workspace_Impl::insertIntoIdfReferencesMap(
@@ -2303,6 +2491,15 @@ namespace detail {
     // erase entry if set is empty
     if (iotmLoc->second.empty()) { m_iddObjectTypeMap.erase(iotmLoc); }
 
+    // DataFieldsHashIndexMap
+    removeFromDataFieldsHashIndex(handle,objectImplPtr->iddObject().type());
+
+    // ValidityCacheMap
+    for (auto& p : m_validityCacheMap) {
+      p.second.errorsByHandle.erase(handle);
+      p.second.dirtyHandles.erase(handle);
+    }
+
     // WorkspaceObjectOrder
     if (m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.erase(handle);
@@ -2852,6 +3049,10 @@ std::vector<WorkspaceObject> Workspace::getObjectsByType(const IddObject& object
   return m_impl->getObjectsByType(objectType);
 }
 
+std::vector<double> Workspace::getDoublesByType(IddObjectType objectType, unsigned index) const {
+  return m_impl->getDoublesByType(objectType, index);
+}
+
 boost::optional<WorkspaceObject> Workspace::getObjectByTypeAndName(IddObjectType objectType,
                                                                    const std::string& name) const
 {
@@ -3061,8 +3262,15 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p,overwrite);
 }
 
+bool Workspace::saveSnapshot(const openstudio::path& p, bool overwrite) {
+  return m_impl->saveSnapshot(p,overwrite);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
-  OptionalIdfFile oIdfFile = IdfFile::load(p);
+  OptionalIdfFile oIdfFile = IdfFile::loadCurrentSnapshot(p);
+  if (!oIdfFile) {
+    oIdfFile = IdfFile::load(p);
+  }
   if (oIdfFile) {
     return Workspace(*oIdfFile);
   }
@@ -3072,7 +3280,10 @@ boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
 boost::optional<Workspace> Workspace::load(const openstudio::path& p,
                                            const IddFileType& iddFileType)
 {
-  OptionalIdfFile oIdfFile = IdfFile::load(p,iddFileType);
+  OptionalIdfFile oIdfFile = IdfFile::loadCurrentSnapshot(p,iddFileType);
+  if (!oIdfFile) {
+    oIdfFile = IdfFile::load(p,iddFileType);
+  }
   if (oIdfFile) {
     return Workspace(*oIdfFile);
   }
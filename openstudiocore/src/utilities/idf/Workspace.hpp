@@ -207,6 +207,11 @@ class UTILITIES_API Workspace {
   /** Returns all objects with .iddObject() == objectType. */
   std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+  /** Returns field index of every object of type objectType as a double, in the same order as
+   *  getObjectsByType(objectType). Empty or non-numeric fields are NaN. Reads the fields without
+   *  constructing a WorkspaceObject per object, for bulk access from the language bindings. */
+  std::vector<double> getDoublesByType(IddObjectType objectType, unsigned index) const;
+
   /** Returns the first object found of type objectType and named name (case insensitive,
    *  exact match). */
   boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType,
@@ -417,12 +422,19 @@ class UTILITIES_API Workspace {
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Save this Workspace to path p as a binary snapshot, see IdfFile::saveSnapshot. Saving a
+   *  snapshot to IdfFile::snapshotPath of a file written by save lets later calls to load (and
+   *  Model::load) skip parsing that file. */
+  bool saveSnapshot(const openstudio::path& p, bool overwrite=false);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
-   *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
+   *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) If a snapshot saved for
+   *  the current contents of p exists at IdfFile::snapshotPath(p), it is loaded instead of p. */
   static boost::optional<Workspace> load(const openstudio::path& p);
 
-  /** Load a Workspace from path using the IddFactory and iddFileType. */
+  /** Load a Workspace from path using the IddFactory and iddFileType. Uses a snapshot saved
+   *  for the current contents of p if one exists. */
   static boost::optional<Workspace> load(const openstudio::path& p,
                                          const IddFileType& iddFileType);
 
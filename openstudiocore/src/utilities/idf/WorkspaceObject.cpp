@@ -908,6 +908,10 @@ namespace detail {
       return;
     }
 
+    if (initialized()) {
+      m_workspace->registerValidityChange(m_handle);
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -951,6 +955,9 @@ namespace detail {
     }
 
     if (dataChange){
+      if (initialized()) {
+        m_workspace->registerDataFieldsChange(m_handle,iddObject().type());
+      }
       this->onDataChange.nano_emit();
     }
 
@@ -976,6 +983,8 @@ namespace detail {
   // Post-condition: field index is a pointer with a null targetHandle.
   void WorkspaceObject_Impl::nullifyPointer(unsigned index) {
     OS_ASSERT(!m_handle.isNull());
+    // pointers are changed without emitting change signals when targets are removed
+    m_workspace->registerValidityChange(m_handle);
     // reverse pointer
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
@@ -1056,6 +1065,7 @@ namespace detail {
   // Post-condition: Field index points to object targetHandle.
   Handle WorkspaceObject_Impl::setPointerImpl(unsigned index, const Handle& targetHandle) {
     OS_ASSERT(!m_handle.isNull());
+    m_workspace->registerValidityChange(m_handle);
     Handle result;
     // check current status
     auto fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers,index);
@@ -36,6 +36,7 @@
 #include <utilities/idf/WorkspaceObjectOrder.hpp>
 #include <utilities/idf/ValidityEnums.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
+#include <utilities/idf/DataError.hpp>
 
 #include <utilities/idd/IddFileAndFactoryWrapper.hpp>
 #include <nano/nano_signal_slot.hpp> // Signal-Slot replacement
@@ -50,6 +51,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -188,6 +190,8 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    std::vector<double> getDoublesByType(IddObjectType objectType, unsigned index) const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType,
@@ -354,6 +358,14 @@ namespace detail {
                                    unsigned index,
                                    const WorkspaceObject& targetObject);
 
+    /** Register that the data fields of the object with handle have changed, so that its entry in
+     *  the equivalent object index is recomputed before the next lookup. */
+    void registerDataFieldsChange(const Handle& handle, IddObjectType type);
+
+    /** Register that the object with handle has changed in a way that may affect its own validity,
+     *  so that it is re-checked by the next validityReport. */
+    void registerValidityChange(const Handle& handle);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
@@ -438,6 +450,9 @@ namespace detail {
      *  .idf or modelFileExtension() depending on the underlying IddFileType. */
     virtual bool save(const openstudio::path& p, bool overwrite=false);
 
+    /** Save Workspace to path as a binary snapshot. See IdfFile::saveSnapshot. */
+    bool saveSnapshot(const openstudio::path& p, bool overwrite=false);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
@@ -527,6 +542,31 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap; // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // index of data field hashes for one IddObjectType, used by getEquivalentObject to find
+    // candidates for unnamed objects without comparing against every object of that type.
+    // stale handles were added or edited since the index was built, and are rehashed on lookup.
+    struct DataFieldsHashIndex {
+      std::unordered_multimap<std::size_t, Handle> handlesByHash;
+      std::unordered_map<Handle, std::size_t, boost::hash<boost::uuids::uuid> > hashesByHandle;
+      std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > staleHandles;
+      void erase(const Handle& handle);
+    };
+
+    // map of IddObjectType to data field hash index. entries are built lazily on first lookup.
+    typedef std::map<IddObjectType, DataFieldsHashIndex> DataFieldsHashIndexMap;
+    mutable DataFieldsHashIndexMap m_dataFieldsHashIndexMap;
+
+    // object-level validity errors from the last validityReport at one strictness level. objects
+    // that are dirty or have no entry are re-checked by the next report, the rest are reused.
+    struct ValidityCache {
+      std::unordered_map<Handle, std::vector<DataError>, boost::hash<boost::uuids::uuid> > errorsByHandle;
+      std::unordered_set<Handle, boost::hash<boost::uuids::uuid> > dirtyHandles;
+    };
+
+    // map of StrictnessLevel value to validity cache. entries are built on first report.
+    typedef std::map<int, ValidityCache> ValidityCacheMap;
+    mutable ValidityCacheMap m_validityCacheMap;
+
     // data object for undos
     struct SavedWorkspaceObject {
       Handle                   handle;
@@ -553,6 +593,20 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    /** Returns the up-to-date data field hash index for type, building it if necessary. */
+    const DataFieldsHashIndex& dataFieldsHashIndex(IddObjectType type) const;
+
+    void removeFromDataFieldsHashIndex(const Handle& handle, IddObjectType type);
+
+    /** Returns the object-level errors for object at level, including NoIdd errors. */
+    std::vector<DataError> objectValidityErrors(const WorkspaceObject_Impl& object, StrictnessLevel level) const;
+
+    /** Fills errors with objectValidityErrors for each of objects, sharding large sets across
+     *  threads. */
+    void checkObjectValidity(const std::vector<std::shared_ptr<WorkspaceObject_Impl> >& objects,
+                             StrictnessLevel level,
+                             std::vector<std::vector<DataError> >& errors) const;
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -1363,6 +1363,51 @@ int SqlFile::execute(const std::string& statement)
   return result;
 }
 
+void SqlFile::setTabularDataCacheEnabled(bool enabled)
+{
+  if (m_impl){
+    m_impl->setTabularDataCacheEnabled(enabled);
+  }
+}
+
+bool SqlFile::tabularDataCacheEnabled() const
+{
+  bool result = false;
+  if (m_impl){
+    result = m_impl->tabularDataCacheEnabled();
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::tabularDataDouble(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->tabularDataDouble(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<std::string> SqlFile::tabularDataString(const std::string& reportName, const std::string& reportForString,
+    const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const
+{
+  boost::optional<std::string> result;
+  if (m_impl){
+    result = m_impl->tabularDataString(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::componentSizingValue(const std::string& componentName, const std::string& description) const
+{
+  boost::optional<double> result;
+  if (m_impl){
+    result = m_impl->componentSizingValue(componentName, description);
+  }
+  return result;
+}
+
 openstudio::OptionalTimeSeries SqlFile::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue)
 {
   openstudio::OptionalTimeSeries result;
@@ -831,6 +831,27 @@ class UTILITIES_API SqlFile {
   /// execute a statement and return the error code, used for create/drop tables
   int execute(const std::string& statement);
 
+  /** When enabled, the TabularDataWithStrings view is read into memory the first time it is needed and
+   *  all tabular report queries, including the summary, cost and end use methods of this class, are
+   *  answered from an index instead of the database. Recommended when querying many tabular values. */
+  void setTabularDataCacheEnabled(bool enabled);
+
+  /// returns true if the in memory tabular data cache is enabled
+  bool tabularDataCacheEnabled() const;
+
+  /// returns the first tabular value matching all arguments as a double
+  boost::optional<double> tabularDataDouble(const std::string& reportName, const std::string& reportForString,
+      const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+  /// returns the first tabular value matching all arguments as a string
+  boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+      const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+  /** Returns the value in the Component Sizing Information table of the Initialization Summary for the component
+   *  named componentName, in upper case as written by EnergyPlus, and description, e.g. "Design Size Nominal
+   *  Capacity [W]". The whole table is read into a hash index the first time this is called. */
+  boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
   void insertTimeSeriesData(const std::string &t_variableType, const std::string &t_indexGroup,
       const std::string &t_timestepType, const std::string &t_keyValue, const std::string &t_variableName,
       const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
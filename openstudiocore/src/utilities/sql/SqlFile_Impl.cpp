@@ -36,6 +36,12 @@
 #include "../core/Containers.hpp"
 #include "../core/Assert.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <array>
+#include <map>
+#include <unordered_map>
+
 
 
 using boost::multi_index_container;
@@ -55,8 +61,300 @@ namespace openstudio{
       return std::string(reinterpret_cast<const char*>(column));
     }
 
+    static const char* tabularDataColumnNames[NumTabularDataFields] = {
+      "ReportName", "ReportForString", "TableName", "RowName", "ColumnName", "Units", "Value"
+    };
+
+    /// In memory copy of the TabularDataWithStrings view. Each distinct string is stored once and rows
+    /// refer to strings by index. Rows are kept in the order sqlite returns them so that the first match
+    /// is the same row a SELECT on the view would return first.
+    class TabularDataCache
+    {
+     public:
+
+      explicit TabularDataCache(sqlite3* db)
+      {
+        if (!db) {
+          return;
+        }
+
+        std::string statement("SELECT ");
+        for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+          if (i > 0) {
+            statement += ", ";
+          }
+          statement += tabularDataColumnNames[i];
+        }
+        statement += " FROM TabularDataWithStrings";
+
+        sqlite3_stmt* sqlStmtPtr = nullptr;
+        sqlite3_prepare_v2(db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        if (!sqlStmtPtr) {
+          return;
+        }
+
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          unsigned rowIndex = m_rows.size();
+
+          Row row;
+          for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+            row[i] = intern(sqlite3_column_text(sqlStmtPtr, i));
+          }
+          // let sqlite convert the text so that values match sqlite3_column_double on the view
+          m_numbers.push_back(sqlite3_column_double(sqlStmtPtr, TabularValue));
+          m_rows.push_back(row);
+
+          Key key;
+          std::copy(row.begin(), row.begin() + TabularValue, key.begin());
+          m_firstRowByKey.insert(std::make_pair(key, rowIndex));
+          m_rowsByReportName[row[TabularReportName]].push_back(rowIndex);
+          m_rowsByTableName[row[TabularTableName]].push_back(rowIndex);
+        }
+
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(sqlStmtPtr);
+      }
+
+      /// returns the indices of rows matching query
+      std::vector<unsigned> find(const TabularDataQuery& query, bool firstOnly) const
+      {
+        std::vector<unsigned> result;
+
+        Row ids;
+        bool fullKey = true;
+        for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+          ids[i] = AnyId;
+          if (query.fields[i]) {
+            auto it = m_stringIds.find(*query.fields[i]);
+            if (it == m_stringIds.end()) {
+              // no row can match a string that is not in the table
+              return result;
+            }
+            ids[i] = it->second;
+          } else if (i != TabularValue) {
+            fullKey = false;
+          }
+        }
+
+        if (fullKey && (ids[TabularValue] == AnyId) && firstOnly) {
+          Key key;
+          std::copy(ids.begin(), ids.begin() + TabularValue, key.begin());
+          auto it = m_firstRowByKey.find(key);
+          if (it != m_firstRowByKey.end()) {
+            result.push_back(it->second);
+          }
+          return result;
+        }
+
+        const std::vector<unsigned>* candidates = nullptr;
+        if (ids[TabularReportName] != AnyId) {
+          candidates = bucket(m_rowsByReportName, ids[TabularReportName]);
+        } else if (ids[TabularTableName] != AnyId) {
+          candidates = bucket(m_rowsByTableName, ids[TabularTableName]);
+        }
+
+        unsigned n = candidates ? candidates->size() : m_rows.size();
+        for (unsigned i = 0; i < n; ++i) {
+          unsigned rowIndex = candidates ? (*candidates)[i] : i;
+          if (matches(m_rows[rowIndex], ids)) {
+            result.push_back(rowIndex);
+            if (firstOnly) {
+              break;
+            }
+          }
+        }
+
+        return result;
+      }
+
+      const std::string& field(unsigned rowIndex, TabularDataField column) const
+      {
+        static const std::string empty;
+        unsigned id = m_rows[rowIndex][column];
+        if (id == NullId) {
+          return empty;
+        }
+        return m_strings[id];
+      }
+
+      double number(unsigned rowIndex) const
+      {
+        return m_numbers[rowIndex];
+      }
+
+      unsigned numRows() const
+      {
+        return m_rows.size();
+      }
+
+     private:
+
+      typedef std::array<unsigned, NumTabularDataFields> Row;
+      typedef std::array<unsigned, TabularValue> Key;
+      typedef std::unordered_map<unsigned, std::vector<unsigned> > RowBuckets;
+
+      // ids that never refer to a string, NULL columns never compare equal to a query value
+      static const unsigned NullId = 0xFFFFFFFF;
+      static const unsigned AnyId = 0xFFFFFFFE;
+
+      unsigned intern(const unsigned char* text)
+      {
+        if (!text) {
+          return NullId;
+        }
+        std::string str(reinterpret_cast<const char*>(text));
+        auto it = m_stringIds.find(str);
+        if (it != m_stringIds.end()) {
+          return it->second;
+        }
+        unsigned id = m_strings.size();
+        m_strings.push_back(str);
+        m_stringIds.insert(std::make_pair(str, id));
+        return id;
+      }
+
+      static const std::vector<unsigned>* bucket(const RowBuckets& buckets, unsigned id)
+      {
+        static const std::vector<unsigned> empty;
+        auto it = buckets.find(id);
+        if (it == buckets.end()) {
+          return &empty;
+        }
+        return &it->second;
+      }
+
+      static bool matches(const Row& row, const Row& ids)
+      {
+        for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+          if ((ids[i] != AnyId) && (ids[i] != row[i])) {
+            return false;
+          }
+        }
+        return true;
+      }
+
+      std::vector<std::string> m_strings;
+      std::unordered_map<std::string, unsigned> m_stringIds;
+      std::vector<Row> m_rows;
+      std::vector<double> m_numbers;
+      std::map<Key, unsigned> m_firstRowByKey;
+      RowBuckets m_rowsByReportName;
+      RowBuckets m_rowsByTableName;
+    };
+
+    /// Values of the Component Sizing Information table in the Initialization Summary, by component name and
+    /// description. The description includes units, e.g. "Design Size Nominal Capacity [W]". When several
+    /// rows share a name and description the first is kept, as for a SELECT on the view.
+    class ComponentSizingIndex
+    {
+     public:
+
+      explicit ComponentSizingIndex(sqlite3* db)
+      {
+        if (!db) {
+          return;
+        }
+
+        std::string statement("SELECT RowName, ColumnName, Value FROM TabularDataWithStrings "
+                              "WHERE ReportName='Initialization Summary' AND ReportForString='Entire Facility' "
+                              "AND TableName='Component Sizing Information'");
+
+        sqlite3_stmt* sqlStmtPtr = nullptr;
+        sqlite3_prepare_v2(db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+        if (!sqlStmtPtr) {
+          return;
+        }
+
+        // each cell of the table is a record, so first gather the cells of each row
+        std::vector<Row> rows;
+        std::unordered_map<std::string, unsigned> rowIndices;
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+          const unsigned char* rowName = sqlite3_column_text(sqlStmtPtr, 0);
+          const unsigned char* columnName = sqlite3_column_text(sqlStmtPtr, 1);
+          const unsigned char* value = sqlite3_column_text(sqlStmtPtr, 2);
+          if (!rowName || !columnName || !value) {
+            continue;
+          }
+
+          auto inserted = rowIndices.insert(std::make_pair(columnText(rowName), static_cast<unsigned>(rows.size())));
+          if (inserted.second) {
+            rows.push_back(Row());
+          }
+          Row& row = rows[inserted.first->second];
+
+          std::string column = columnText(columnName);
+          if (column == "Value") {
+            row.value = sqlite3_column_double(sqlStmtPtr, 2);
+          } else if (column.find("Name") != std::string::npos) {
+            row.name = columnText(value);
+          } else if (column.find("Description") != std::string::npos) {
+            row.description = columnText(value);
+          }
+        }
+
+        // must finalize to prevent memory leaks
+        sqlite3_finalize(sqlStmtPtr);
+
+        for (const Row& row : rows) {
+          if (row.value) {
+            // insert does not replace, so the first row wins
+            m_values.insert(std::make_pair(std::make_pair(row.name, row.description), *row.value));
+          }
+        }
+      }
+
+      boost::optional<double> value(const std::string& componentName, const std::string& description) const
+      {
+        boost::optional<double> result;
+        auto it = m_values.find(std::make_pair(componentName, description));
+        if (it != m_values.end()) {
+          result = it->second;
+        }
+        return result;
+      }
+
+      unsigned size() const
+      {
+        return m_values.size();
+      }
+
+     private:
+
+      struct Row {
+        std::string name;
+        std::string description;
+        boost::optional<double> value;
+      };
+
+      typedef std::pair<std::string, std::string> Key;
+      std::unordered_map<Key, double, boost::hash<Key> > m_values;
+    };
+
+    // query for a column of the Annual Cost table in the Economics Results Summary Report
+    TabularDataQuery economicsAnnualCostQuery(const std::string& columnName)
+    {
+      TabularDataQuery result;
+      result.fields[TabularReportName] = std::string("Economics Results Summary Report");
+      result.fields[TabularReportForString] = std::string("Entire Facility");
+      result.fields[TabularColumnName] = columnName;
+      return result;
+    }
+
+    TabularDataQuery tabularDataQuery(const std::string& reportName, const std::string& reportForString,
+        const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units)
+    {
+      TabularDataQuery result;
+      result.fields[TabularReportName] = reportName;
+      result.fields[TabularReportForString] = reportForString;
+      result.fields[TabularTableName] = tableName;
+      result.fields[TabularRowName] = rowName;
+      result.fields[TabularColumnName] = columnName;
+      result.fields[TabularUnits] = units;
+      return result;
+    }
+
     SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false)
+      : m_path(path), m_connectionOpen(false), m_supportedVersion(false), m_tabularDataCacheEnabled(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -67,7 +365,7 @@ namespace openstudio{
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_tabularDataCacheEnabled(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -412,6 +710,8 @@ namespace openstudio{
         sqlite3_close(m_db);
         m_connectionOpen = false;
       }
+      m_tabularDataCache.reset();
+      m_componentSizingIndex.reset();
       return true;
     }
 
@@ -870,14 +1170,14 @@ namespace openstudio{
         boost::algorithm::to_upper_copy(t_fuelType.valueName());
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='J'";
+      TabularDataQuery query;
+      query.fields[TabularReportName] = reportname;
+      query.fields[TabularReportForString] = std::string("Meter");
+      query.fields[TabularRowName] = rowname;
+      query.fields[TabularColumnName] = columnname;
+      query.fields[TabularUnits] = std::string("J");
 
-      return execAndReturnFirstDouble(s);
+      return tabularDataFirstDouble(query);
     }
 
     //TODO
@@ -892,26 +1192,26 @@ namespace openstudio{
         " {AT MAX/MIN}";
       const std::string rowname = t_monthOfYear.valueDescription();
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='" + reportname + "' and \
-                              ReportForString='Meter' AND \
-                              RowName='" + rowname + "' AND \
-                              ColumnName='" + columnname + "' AND \
-                              Units='W'";
+      TabularDataQuery query;
+      query.fields[TabularReportName] = reportname;
+      query.fields[TabularReportForString] = std::string("Meter");
+      query.fields[TabularRowName] = rowname;
+      query.fields[TabularColumnName] = columnname;
+      query.fields[TabularUnits] = std::string("W");
 
-      return execAndReturnFirstDouble(s);
+      return tabularDataFirstDouble(query);
     }
 
     /// hours simulated
     boost::optional<double> SqlFile_Impl::hoursSimulated() const
     {
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='InputVerificationandResultsSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='General' AND \
-                              RowName='Hours Simulated' AND \
-                              Units='hrs'";
-      boost::optional<double> ret = execAndReturnFirstDouble(s);
+      TabularDataQuery query;
+      query.fields[TabularReportName] = std::string("InputVerificationandResultsSummary");
+      query.fields[TabularReportForString] = std::string("Entire Facility");
+      query.fields[TabularTableName] = std::string("General");
+      query.fields[TabularRowName] = std::string("Hours Simulated");
+      query.fields[TabularUnits] = std::string("hrs");
+      boost::optional<double> ret = tabularDataFirstDouble(query);
 
       if (ret) return ret;
 
@@ -934,14 +1234,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -965,14 +1259,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -985,14 +1273,8 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -1005,24 +1287,18 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::annualTotalCost(const FuelType& fuel) const
     {
       if (fuel == FuelType::Electricity){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Electric') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue(economicsAnnualCostQuery("Electric"));
       }
       else if (fuel == FuelType::Gas){
-        return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Gas') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+        return annualCostValue(economicsAnnualCostQuery("Gas"));
       }
       else {
         // E+ lumps all other fuel types under "Other," so we are forced to use the meters table instead.
@@ -1060,9 +1336,17 @@ namespace openstudio{
           meterName = "ENERGYTRANSFER:FACILITY";
         }
 
-        auto rowName = execAndReturnFirstString("SELECT RowName FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value='" + meterName + "'");
-        if (rowName){
-          return execAndReturnFirstDouble("SELECT Value FROM tabulardatawithstrings WHERE ReportName='Economics Results Summary Report' AND ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName='" + rowName.get() + "' AND ColumnName='Annual Cost (~~$~~)'");
+        TabularDataQuery query;
+        query.fields[TabularReportName] = std::string("Economics Results Summary Report");
+        query.fields[TabularReportForString] = std::string("Entire Facility");
+        query.fields[TabularTableName] = std::string("Tariff Summary");
+        query.fields[TabularValue] = meterName;
+        std::vector<std::string> rowNames = tabularDataStrings(TabularRowName, query);
+        if (!rowNames.empty()){
+          query.fields[TabularValue].reset();
+          query.fields[TabularRowName] = rowNames.front();
+          query.fields[TabularColumnName] = std::string("Annual Cost (~~$~~)");
+          return tabularDataFirstDouble(query);
         }
         else {
           return boost::none; // Return an empty optional double, indicating that there is no annual cost for this energy type
@@ -1076,7 +1360,8 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Building Area", "Total Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1094,7 +1379,8 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+          "Building Area", "Net Conditioned Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1222,47 +1508,51 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::economicsEnergyCost() const
     {
-      return execAndReturnFirstDouble("SELECT * from tabulardatawithstrings where (reportname = 'Economics Results Summary Report') and (ReportForString = 'Entire Facility') and (TableName = 'Annual Cost') and (ColumnName ='Total') and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)'))");
+      return annualCostValue(economicsAnnualCostQuery("Total"));
     }
 
     OptionalDouble SqlFile_Impl::getElecOrGasUse(bool bGetGas) const
     {
-      boost::optional<std::vector<std::string> > selectedRowNames;
-
-      boost::optional<std::vector<std::string> > qualifiedRowNames;
-      boost::optional<std::vector<std::string> > fuelTypeRowNames;
+      std::vector<std::string> selectedRowNames;
+      std::vector<std::string> qualifiedRowNames;
+      std::vector<std::string> fuelTypeRowNames;
       OptionalDouble result;
 
       std::string fuelType;
       if(bGetGas){
-        fuelType = "'COMM GAS'";
+        fuelType = "COMM GAS";
       }
       else{
-        fuelType = "'COMM ELECT'";
+        fuelType = "COMM ELECT";
       }
 
-      std::string query("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and ColumnName = 'Group' and Value = ");
-      query += fuelType;
+      TabularDataQuery query;
+      query.fields[TabularTableName] = std::string("Tariff Summary");
+
+      query.fields[TabularColumnName] = std::string("Selected");
+      query.fields[TabularValue] = std::string("Yes");
+      selectedRowNames = tabularDataStrings(TabularRowName, query);
 
-      selectedRowNames = execAndReturnVectorOfString("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and (ColumnName = 'Selected' and Value = 'Yes')");
-      qualifiedRowNames = execAndReturnVectorOfString("select rowname from tabulardatawithstrings where TableName = 'Tariff Summary' and (ColumnName = 'Qualified' and Value = 'Yes')");
-      fuelTypeRowNames = execAndReturnVectorOfString(query);
+      query.fields[TabularColumnName] = std::string("Qualified");
+      qualifiedRowNames = tabularDataStrings(TabularRowName, query);
 
-      if(!selectedRowNames || !qualifiedRowNames || !fuelTypeRowNames) return result;
+      query.fields[TabularColumnName] = std::string("Group");
+      query.fields[TabularValue] = fuelType;
+      fuelTypeRowNames = tabularDataStrings(TabularRowName, query);
 
       std::vector<std::string> names;
-      for(unsigned i=0; i<selectedRowNames->size(); i++){
-        for(unsigned j=0; j<qualifiedRowNames->size(); j++){
-          if(selectedRowNames->at(i) == qualifiedRowNames->at(j)){
-            names.push_back(selectedRowNames->at(i));
+      for(unsigned i=0; i<selectedRowNames.size(); i++){
+        for(unsigned j=0; j<qualifiedRowNames.size(); j++){
+          if(selectedRowNames.at(i) == qualifiedRowNames.at(j)){
+            names.push_back(selectedRowNames.at(i));
           }
         }
       }
 
       std::string name;
       for(unsigned i=0; i<names.size(); i++){
-        for(unsigned j=0; j<fuelTypeRowNames->size(); j++){
-          if(names.at(i) == fuelTypeRowNames->at(j)){
+        for(unsigned j=0; j<fuelTypeRowNames.size(); j++){
+          if(names.at(i) == fuelTypeRowNames.at(j)){
             name = names.at(i);
             break;
           }
@@ -1270,10 +1560,13 @@ namespace openstudio{
       }
       if(name.size() == 0) return result;
 
-      query = "SELECT value from tabulardatawithstrings where ReportName = 'Tariff Report' and ReportForString = '";
-      query += name;
-      query +=  "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-      result = execAndReturnFirstDouble(query);
+      query = TabularDataQuery();
+      query.fields[TabularReportName] = std::string("Tariff Report");
+      query.fields[TabularReportForString] = name;
+      query.fields[TabularTableName] = std::string("Native Variables");
+      query.fields[TabularRowName] = std::string("TotalEnergy");
+      query.fields[TabularColumnName] = std::string("Sum");
+      result = tabularDataFirstDouble(query);
 
       return result;
     }
@@ -1283,16 +1576,16 @@ namespace openstudio{
     {
       std::string fuelType;
       if(bGetGas){
-        fuelType = "'Gas'";
+        fuelType = "Gas";
       }
       else{
-        fuelType = "'Electric'";
+        fuelType = "Electric";
       }
 
-      std::string query("select value from tabulardatawithstrings where TableName = 'Annual Cost' and (((RowName = 'Cost') and (Units = '~~$~~')) or (RowName = 'Cost (~~$~~)')) and ColumnName = ");
-      query += fuelType;
+      TabularDataQuery query;
+      query.fields[TabularColumnName] = fuelType;
 
-      return execAndReturnFirstDouble(query);
+      return annualCostValue(query);
     }
 
     boost::optional<EndUses> SqlFile_Impl::endUses() const
@@ -1303,10 +1596,8 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+              category.valueDescription(), fuelType.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1322,464 +1613,464 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Heating') AND (Units = 'hr')");
+      return tabularDataDouble("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Heating", "hr");
     }
 
     OptionalDouble SqlFile_Impl::hoursCoolingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Cooling') AND (Units = 'hr')");
+      return tabularDataDouble("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Cooling", "hr");
     }
 
 
@@ -2056,9 +2347,162 @@ namespace openstudio{
         // must finalize to prevent memory leaks
         sqlite3_finalize(sqlStmtPtr);
       }
+
+      // the statement may have changed the tabular data, reload it on next use
+      m_tabularDataCache.reset();
+      m_componentSizingIndex.reset();
+
       return code;
     }
 
+    void SqlFile_Impl::setTabularDataCacheEnabled(bool enabled)
+    {
+      m_tabularDataCacheEnabled = enabled;
+      if (!enabled) {
+        m_tabularDataCache.reset();
+      }
+    }
+
+    bool SqlFile_Impl::tabularDataCacheEnabled() const
+    {
+      return m_tabularDataCacheEnabled;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataDouble(const std::string& reportName, const std::string& reportForString,
+        const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const
+    {
+      return tabularDataFirstDouble(tabularDataQuery(reportName, reportForString, tableName, rowName, columnName, units));
+    }
+
+    boost::optional<std::string> SqlFile_Impl::tabularDataString(const std::string& reportName, const std::string& reportForString,
+        const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const
+    {
+      boost::optional<std::string> result;
+      std::vector<std::string> values = tabularDataStrings(TabularValue,
+          tabularDataQuery(reportName, reportForString, tableName, rowName, columnName, units));
+      if (!values.empty()) {
+        result = values.front();
+      }
+      return result;
+    }
+
+    const TabularDataCache& SqlFile_Impl::tabularDataCache() const
+    {
+      if (!m_tabularDataCache) {
+        m_tabularDataCache = std::make_shared<TabularDataCache>(m_connectionOpen ? m_db : nullptr);
+        LOG(Debug, "Loaded " << m_tabularDataCache->numRows() << " rows of tabular data");
+      }
+      return *m_tabularDataCache;
+    }
+
+    const ComponentSizingIndex& SqlFile_Impl::componentSizingIndex() const
+    {
+      if (!m_componentSizingIndex) {
+        m_componentSizingIndex = std::make_shared<ComponentSizingIndex>(m_connectionOpen ? m_db : nullptr);
+        LOG(Debug, "Loaded " << m_componentSizingIndex->size() << " component sizing values");
+      }
+      return *m_componentSizingIndex;
+    }
+
+    boost::optional<double> SqlFile_Impl::componentSizingValue(const std::string& componentName, const std::string& description) const
+    {
+      return componentSizingIndex().value(componentName, description);
+    }
+
+    // prepares a SELECT of column from TabularDataWithStrings with one bound parameter per field set in query
+    std::shared_ptr<PreparedStatement> prepareTabularDataStatement(sqlite3* db, TabularDataField column, const TabularDataQuery& query)
+    {
+      std::string statement = std::string("SELECT ") + tabularDataColumnNames[column] + " FROM TabularDataWithStrings";
+      bool first = true;
+      for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+        if (query.fields[i]) {
+          statement += (first ? " WHERE " : " AND ");
+          statement += tabularDataColumnNames[i];
+          statement += "=?";
+          first = false;
+        }
+      }
+
+      std::shared_ptr<PreparedStatement> result = std::make_shared<PreparedStatement>(statement, db);
+      int position = 1;
+      for (unsigned i = 0; i < NumTabularDataFields; ++i) {
+        if (query.fields[i]) {
+          result->bind(position, *query.fields[i]);
+          ++position;
+        }
+      }
+      return result;
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataFirstDouble(const TabularDataQuery& query) const
+    {
+      boost::optional<double> result;
+
+      if (m_tabularDataCacheEnabled) {
+        const TabularDataCache& cache = tabularDataCache();
+        std::vector<unsigned> rows = cache.find(query, true);
+        if (!rows.empty()) {
+          result = cache.number(rows.front());
+        }
+        return result;
+      }
+
+      if (m_connectionOpen) {
+        try {
+          std::shared_ptr<PreparedStatement> stmt = prepareTabularDataStatement(m_db, TabularValue, query);
+          if (sqlite3_step(stmt->m_statement) == SQLITE_ROW) {
+            result = sqlite3_column_double(stmt->m_statement, 0);
+          }
+        } catch (const std::exception& e) {
+          LOG(Debug, e.what());
+        }
+      }
+
+      return result;
+    }
+
+    boost::optional<double> SqlFile_Impl::annualCostValue(TabularDataQuery query) const
+    {
+      // older versions of EnergyPlus report the units in their own column, newer ones in the row name
+      query.fields[TabularTableName] = std::string("Annual Cost");
+      query.fields[TabularRowName] = std::string("Cost");
+      query.fields[TabularUnits] = std::string("~~$~~");
+      boost::optional<double> result = tabularDataFirstDouble(query);
+      if (!result) {
+        query.fields[TabularRowName] = std::string("Cost (~~$~~)");
+        query.fields[TabularUnits].reset();
+        result = tabularDataFirstDouble(query);
+      }
+      return result;
+    }
+
+    std::vector<std::string> SqlFile_Impl::tabularDataStrings(TabularDataField column, const TabularDataQuery& query) const
+    {
+      std::vector<std::string> result;
+
+      if (m_tabularDataCacheEnabled) {
+        const TabularDataCache& cache = tabularDataCache();
+        for (unsigned row : cache.find(query, false)) {
+          result.push_back(cache.field(row, column));
+        }
+        return result;
+      }
+
+      if (m_connectionOpen) {
+        try {
+          std::shared_ptr<PreparedStatement> stmt = prepareTabularDataStatement(m_db, column, query);
+          while (sqlite3_step(stmt->m_statement) == SQLITE_ROW) {
+            const unsigned char* text = sqlite3_column_text(stmt->m_statement, 0);
+            result.push_back(text ? columnText(text) : std::string());
+          }
+        } catch (const std::exception& e) {
+          LOG(Debug, e.what());
+        }
+      }
+
+      return result;
+    }
+
     std::vector<double> SqlFile_Impl::timeSeriesValues(const DataDictionaryItem& dataDictionary)
     {
       std::vector<double> stdValues;
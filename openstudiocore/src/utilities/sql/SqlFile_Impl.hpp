@@ -45,6 +45,7 @@
 
 #include <string>
 #include <vector>
+#include <memory>
 
 namespace openstudio{
 
@@ -57,6 +58,29 @@ namespace openstudio{
   // private namespace
   namespace detail{
 
+    // columns of the TabularDataWithStrings view
+    enum TabularDataField {
+      TabularReportName = 0,
+      TabularReportForString,
+      TabularTableName,
+      TabularRowName,
+      TabularColumnName,
+      TabularUnits,
+      TabularValue,
+      NumTabularDataFields
+    };
+
+    // a query against the TabularDataWithStrings view, fields that are not set match any value
+    struct TabularDataQuery {
+      boost::optional<std::string> fields[NumTabularDataFields];
+    };
+
+    // in memory index of the TabularDataWithStrings view, defined in SqlFile_Impl.cpp
+    class TabularDataCache;
+
+    // index of the Component Sizing Information table, defined in SqlFile_Impl.cpp
+    class ComponentSizingIndex;
+
     class UTILITIES_API SqlFile_Impl {
     public:
 
@@ -759,6 +783,24 @@ namespace openstudio{
       // execute a statement and return the error code, used for create/drop tables
       int execute(const std::string& statement);
 
+      /// when enabled, the TabularDataWithStrings view is read into memory the first time it is needed
+      /// and all tabular report queries are answered from that index rather than from the database
+      void setTabularDataCacheEnabled(bool enabled);
+
+      /// returns true if the in memory tabular data cache is enabled
+      bool tabularDataCacheEnabled() const;
+
+      /// returns the first value in the tabular data matching all arguments as a double
+      boost::optional<double> tabularDataDouble(const std::string& reportName, const std::string& reportForString,
+          const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+      /// returns the first value in the tabular data matching all arguments as a string
+      boost::optional<std::string> tabularDataString(const std::string& reportName, const std::string& reportForString,
+          const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+      /// returns the Value in the Component Sizing Information table for componentName and description
+      boost::optional<double> componentSizingValue(const std::string& componentName, const std::string& description) const;
+
       /// Returns the summary data for each install location and fuel type found in report variables
       std::vector<openstudio::SummaryData> getSummaryData() const;
 
@@ -797,6 +839,21 @@ namespace openstudio{
 
     private:
 
+      // returns the first Value matching query as a double
+      boost::optional<double> tabularDataFirstDouble(const TabularDataQuery& query) const;
+
+      // returns the Value in the Annual Cost table matching query, for both old and new row naming
+      boost::optional<double> annualCostValue(TabularDataQuery query) const;
+
+      // returns the requested column of every row matching query
+      std::vector<std::string> tabularDataStrings(TabularDataField column, const TabularDataQuery& query) const;
+
+      // loads the tabular data cache if needed
+      const TabularDataCache& tabularDataCache() const;
+
+      // loads the component sizing index if needed
+      const ComponentSizingIndex& componentSizingIndex() const;
+
       void init();
 
       void retrieveDataDictionary();
@@ -834,6 +891,10 @@ namespace openstudio{
 
       bool m_supportedVersion;
 
+      bool m_tabularDataCacheEnabled;
+      mutable std::shared_ptr<TabularDataCache> m_tabularDataCache;
+      mutable std::shared_ptr<ComponentSizingIndex> m_componentSizingIndex;
+
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
 
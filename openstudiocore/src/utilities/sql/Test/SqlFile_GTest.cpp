@@ -320,6 +320,75 @@ TEST_F(SqlFileFixture, AnnualTotalCosts) {
 
 }
 
+TEST_F(SqlFileFixture, TabularDataCache) {
+  ASSERT_FALSE(sqlFile2.tabularDataCacheEnabled());
+
+  boost::optional<double> netSiteEnergy = sqlFile2.netSiteEnergy();
+  boost::optional<double> annualTotalUtilityCost = sqlFile2.annualTotalUtilityCost();
+  boost::optional<double> waterCost = sqlFile2.annualTotalCost(FuelType::Water);
+  boost::optional<double> economicsEnergyCost = sqlFile2.economicsEnergyCost();
+  boost::optional<double> hoursCoolingSetpointNotMet = sqlFile2.hoursCoolingSetpointNotMet();
+  boost::optional<EndUses> endUses = sqlFile2.endUses();
+  ASSERT_TRUE(netSiteEnergy);
+  ASSERT_TRUE(annualTotalUtilityCost);
+  ASSERT_TRUE(waterCost);
+  ASSERT_TRUE(endUses);
+
+  boost::optional<double> totalBuildingArea = sqlFile2.tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                                                         "Building Area", "Total Building Area", "Area", "m2");
+  ASSERT_TRUE(totalBuildingArea);
+  EXPECT_FALSE(sqlFile2.tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                          "Building Area", "Total Building Area", "Area", "ft2"));
+
+  // names containing quotes do not break the query
+  EXPECT_FALSE(sqlFile2.tabularDataString("Report's Name", "Entire Facility", "Table", "Row", "Column", ""));
+
+  sqlFile2.setTabularDataCacheEnabled(true);
+  EXPECT_TRUE(sqlFile2.tabularDataCacheEnabled());
+
+  EXPECT_EQ(netSiteEnergy, sqlFile2.netSiteEnergy());
+  EXPECT_EQ(annualTotalUtilityCost, sqlFile2.annualTotalUtilityCost());
+  EXPECT_EQ(waterCost, sqlFile2.annualTotalCost(FuelType::Water));
+  EXPECT_EQ(economicsEnergyCost, sqlFile2.economicsEnergyCost());
+  EXPECT_EQ(hoursCoolingSetpointNotMet, sqlFile2.hoursCoolingSetpointNotMet());
+  EXPECT_EQ(totalBuildingArea, sqlFile2.tabularDataDouble("AnnualBuildingUtilityPerformanceSummary", "Entire Facility",
+                                                          "Building Area", "Total Building Area", "Area", "m2"));
+  EXPECT_FALSE(sqlFile2.tabularDataString("Report's Name", "Entire Facility", "Table", "Row", "Column", ""));
+
+  boost::optional<EndUses> cachedEndUses = sqlFile2.endUses();
+  ASSERT_TRUE(cachedEndUses);
+  for (const EndUseFuelType& fuelType : endUses->fuelTypes()) {
+    for (const EndUseCategoryType& category : endUses->categories()) {
+      EXPECT_EQ(endUses->getEndUse(fuelType, category), cachedEndUses->getEndUse(fuelType, category));
+    }
+  }
+
+  sqlFile2.setTabularDataCacheEnabled(false);
+  EXPECT_FALSE(sqlFile2.tabularDataCacheEnabled());
+}
+
+TEST_F(SqlFileFixture, ComponentSizingValue) {
+  std::string table("FROM TabularDataWithStrings WHERE ReportName='Initialization Summary' AND ReportForString='Entire Facility' "
+                    "AND TableName='Component Sizing Information' ");
+
+  boost::optional<std::string> rowName = sqlFile2.execAndReturnFirstString("SELECT RowName " + table + "AND ColumnName='Value'");
+  ASSERT_TRUE(rowName);
+  std::string row = "AND RowName='" + *rowName + "'";
+  boost::optional<std::string> componentName = sqlFile2.execAndReturnFirstString("SELECT Value " + table + "AND ColumnName LIKE '%Name%' " + row);
+  boost::optional<std::string> description = sqlFile2.execAndReturnFirstString("SELECT Value " + table + "AND ColumnName LIKE '%Description%' " + row);
+  boost::optional<double> value = sqlFile2.execAndReturnFirstDouble("SELECT Value " + table + "AND ColumnName='Value' " + row);
+  ASSERT_TRUE(componentName);
+  ASSERT_TRUE(description);
+  ASSERT_TRUE(value);
+
+  boost::optional<double> sizingValue = sqlFile2.componentSizingValue(*componentName, *description);
+  ASSERT_TRUE(sizingValue);
+  EXPECT_DOUBLE_EQ(*value, *sizingValue);
+
+  EXPECT_FALSE(sqlFile2.componentSizingValue("NOT A COMPONENT", *description));
+  EXPECT_FALSE(sqlFile2.componentSizingValue(*componentName, "Not A Description"));
+}
+
 void regressionTestSqlFile(const std::string& name, double netSiteEnergy, double firstVal, double lastVal)
 {
   openstudio::path fromPath = resourcesPath() / toPath("utilities/SqlFile") / toPath(name);
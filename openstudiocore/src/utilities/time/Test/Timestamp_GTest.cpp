@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Timestamp.hpp"
+
+using namespace openstudio;
+
+TEST(Timestamp, Epoch)
+{
+  EXPECT_EQ(0, Timestamp().secondsSinceEpoch());
+  EXPECT_EQ(0, Timestamp(1970, 1, 1).secondsSinceEpoch());
+  EXPECT_EQ(951782400, Timestamp(2000, 2, 29).secondsSinceEpoch());
+  EXPECT_EQ(-86400, Timestamp(1969, 12, 31).secondsSinceEpoch());
+
+  // Agrees with DateTime's own epoch conversion
+  DateTime dateTime(Date(MonthOfYear::Jul, 4, 2009), Time(0, 13, 30, 15));
+  EXPECT_EQ(dateTime.toEpoch(), Timestamp(dateTime).secondsSinceEpoch());
+  EXPECT_EQ(Timestamp(2009, 7, 4, 13, 30, 15), Timestamp(dateTime));
+
+  // UTC offset is removed
+  DateTime local(Date(MonthOfYear::Jul, 4, 2009), Time(0, 13, 30, 15), -5.0);
+  EXPECT_EQ(Timestamp(2009, 7, 4, 18, 30, 15), Timestamp(local));
+
+  EXPECT_THROW(Timestamp(2009, 2, 29), std::exception);
+  EXPECT_THROW(Timestamp(2009, 13, 1), std::exception);
+}
+
+TEST(Timestamp, DateTimeRoundTrip)
+{
+  Timestamp timestamp(2012, 12, 31, 23, 59, 59);
+  DateTime dateTime = timestamp.dateTime();
+  EXPECT_EQ(Date(MonthOfYear::Dec, 31, 2012), dateTime.date());
+  EXPECT_EQ(Time(0, 23, 59, 59), dateTime.time());
+  EXPECT_EQ(timestamp, Timestamp(dateTime));
+
+  // Hour 24 rolls into the next day, as in EnergyPlus output
+  EXPECT_EQ(Timestamp(2013, 1, 1), Timestamp(2012, 12, 31, 24));
+  EXPECT_EQ(3600, Timestamp(2012, 12, 31, 24) - Timestamp(2012, 12, 31, 23));
+  EXPECT_EQ(Timestamp(1969, 12, 31, 23), Timestamp() - 3600);
+  EXPECT_EQ(Date(MonthOfYear::Dec, 31, 1969), (Timestamp() - 3600).dateTime().date());
+}
+
+TEST(Timestamp, BulkConversion)
+{
+  std::vector<unsigned> months = {2, 2, 3, 12, 12};
+  std::vector<unsigned> days = {28, 29, 1, 31, 31};
+  std::vector<int> hours = {1, 1, 0, 23, 24};
+  std::vector<int> minutes = {0, 30, 60, 0, 0};
+
+  TimestampVector timestamps = toTimestamps(2012, months, days, hours, minutes);
+  ASSERT_EQ(5u, timestamps.size());
+  for (unsigned i = 0; i < timestamps.size(); ++i) {
+    EXPECT_EQ(Timestamp(2012, months[i], days[i], hours[i], minutes[i]), timestamps[i]);
+  }
+
+  // Feb 29 is not valid in 2013
+  EXPECT_THROW(toTimestamps(2013, months, days, hours, minutes), std::exception);
+
+  // Mismatched columns
+  hours.pop_back();
+  EXPECT_THROW(toTimestamps(2012, months, days, hours, minutes), std::exception);
+
+  // Data starting mid year wraps into the next year
+  timestamps = toTimestamps(2009, {12, 1}, {31, 1}, {23, 1}, {0, 0}, true);
+  ASSERT_EQ(2u, timestamps.size());
+  EXPECT_EQ(Timestamp(2010, 1, 1, 1), timestamps[1]);
+  timestamps = toTimestamps(2009, {12, 1}, {31, 1}, {23, 1}, {0, 0});
+  EXPECT_EQ(Timestamp(2009, 1, 1, 1), timestamps[1]);
+
+  DateTimeVector dateTimes = toDateTimes(timestamps);
+  ASSERT_EQ(2u, dateTimes.size());
+  EXPECT_EQ(timestamps, toTimestamps(dateTimes));
+}
@@ -8,6 +8,7 @@
 %include <utilities/time/TimeImpl.i>
 %include <utilities/time/Date.i>
 %include <utilities/time/DateTime.i>
+%include <utilities/time/Timestamp.i>
 %include <utilities/time/Calendar.i>
 
 #endif //UTILITIES_TIME_TIME_I
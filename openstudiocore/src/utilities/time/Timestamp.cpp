@@ -0,0 +1,190 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "Timestamp.hpp"
+
+namespace openstudio{
+
+namespace {
+
+  const long long secondsPerDay = 86400;
+
+  // Days from 1970-01-01 to year-month-day in the proleptic Gregorian calendar, valid for any year
+  long long daysFromCivil(int year, unsigned month, unsigned day)
+  {
+    year -= month <= 2;
+    const long long era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    const unsigned dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<long long>(dayOfEra) - 719468;
+  }
+
+  // Inverse of daysFromCivil
+  void civilFromDays(long long days, int& year, unsigned& month, unsigned& day)
+  {
+    days += 719468;
+    const long long era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned mp = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year = static_cast<int>(yearOfEra + era * 400) + (month <= 2);
+  }
+
+  bool isLeapYear(int year)
+  {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+  }
+
+  bool isValidDate(int year, unsigned month, unsigned day)
+  {
+    static const unsigned daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || day < 1) {
+      return false;
+    }
+    unsigned last = daysInMonth[month - 1];
+    if (month == 2 && isLeapYear(year)) {
+      last = 29;
+    }
+    return day <= last;
+  }
+
+  long long secondsFromCivil(int year, unsigned month, unsigned day, int hour, int minute, int second)
+  {
+    if (!isValidDate(year, month, day)) {
+      LOG_FREE_AND_THROW("utilities.time.Timestamp", "Invalid date " << year << "-" << month << "-" << day);
+    }
+    return daysFromCivil(year, month, day) * secondsPerDay + hour * 3600 + minute * 60 + second;
+  }
+
+}
+
+Timestamp::Timestamp()
+  : m_seconds(0)
+{}
+
+Timestamp::Timestamp(long long secondsSinceEpoch)
+  : m_seconds(secondsSinceEpoch)
+{}
+
+Timestamp::Timestamp(const DateTime& dateTime)
+{
+  Date date = dateTime.date();
+  m_seconds = daysFromCivil(date.year(), month(date.monthOfYear()), date.dayOfMonth()) * secondsPerDay
+    + dateTime.time().totalSeconds() - static_cast<long long>(dateTime.utcOffset() * 3600.0);
+}
+
+Timestamp::Timestamp(int year, unsigned month, unsigned day, int hour, int minute, int second)
+  : m_seconds(secondsFromCivil(year, month, day, hour, minute, second))
+{}
+
+DateTime Timestamp::dateTime() const
+{
+  long long days = m_seconds / secondsPerDay;
+  long long seconds = m_seconds % secondsPerDay;
+  if (seconds < 0) {
+    seconds += secondsPerDay;
+    --days;
+  }
+  int year;
+  unsigned month, day;
+  civilFromDays(days, year, month, day);
+  return DateTime(Date(monthOfYear(month), day, year), Time(0, 0, 0, static_cast<int>(seconds)), 0.0);
+}
+
+TimestampVector toTimestamps(int year, const std::vector<unsigned>& months, const std::vector<unsigned>& days,
+  const std::vector<int>& hours, const std::vector<int>& minutes, bool wrapAround)
+{
+  unsigned n = months.size();
+  if (days.size() != n || hours.size() != n || minutes.size() != n) {
+    LOG_FREE_AND_THROW("utilities.time.Timestamp", "Calendar columns must all have the same length");
+  }
+
+  TimestampVector result;
+  result.reserve(n);
+
+  // Days before each month, so each entry costs a table lookup rather than a calendar conversion
+  static const unsigned daysBeforeMonth[] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+  long long yearStart = daysFromCivil(year, 1, 1);
+  bool leap = isLeapYear(year);
+  long long previous = 0;
+  for (unsigned i = 0; i < n; ++i) {
+    unsigned month = months[i];
+    unsigned day = days[i];
+    if (!isValidDate(year, month, day)) {
+      LOG_FREE_AND_THROW("utilities.time.Timestamp", "Invalid date " << year << "-" << month << "-" << day << " at index " << i);
+    }
+    long long dayOfYear = daysBeforeMonth[month - 1] + day - 1 + ((leap && month > 2) ? 1 : 0);
+    long long seconds = (yearStart + dayOfYear) * secondsPerDay + hours[i] * 3600 + minutes[i] * 60;
+    if (wrapAround && i > 0 && seconds < previous) {
+      ++year;
+      yearStart = daysFromCivil(year, 1, 1);
+      leap = isLeapYear(year);
+      if (!isValidDate(year, month, day)) {
+        LOG_FREE_AND_THROW("utilities.time.Timestamp", "Invalid date " << year << "-" << month << "-" << day << " at index " << i);
+      }
+      dayOfYear = daysBeforeMonth[month - 1] + day - 1 + ((leap && month > 2) ? 1 : 0);
+      seconds = (yearStart + dayOfYear) * secondsPerDay + hours[i] * 3600 + minutes[i] * 60;
+    }
+    result.push_back(Timestamp(seconds));
+    previous = seconds;
+  }
+  return result;
+}
+
+TimestampVector toTimestamps(const DateTimeVector& dateTimes)
+{
+  TimestampVector result;
+  result.reserve(dateTimes.size());
+  for (const DateTime& dateTime : dateTimes) {
+    result.push_back(Timestamp(dateTime));
+  }
+  return result;
+}
+
+DateTimeVector toDateTimes(const TimestampVector& timestamps)
+{
+  DateTimeVector result;
+  result.reserve(timestamps.size());
+  for (const Timestamp& timestamp : timestamps) {
+    result.push_back(timestamp.dateTime());
+  }
+  return result;
+}
+
+std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp)
+{
+  os << timestamp.dateTime();
+  return os;
+}
+
+} // openstudio
@@ -0,0 +1,108 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2019, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_TIME_TIMESTAMP_HPP
+#define UTILITIES_TIME_TIMESTAMP_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "DateTime.hpp"
+
+#include <vector>
+
+namespace openstudio{
+
+/// Timestamp is a compact absolute point in time, stored as whole seconds since 1970-01-01 00:00:00 UTC.
+/// It is intended for large time-indexed data sets where a DateTime per entry is too heavy; use DateTime
+/// for anything calendar related and convert at the boundaries.
+class UTILITIES_API Timestamp {
+ public:
+
+  /// default constructor, 1970-01-01 00:00:00 UTC
+  Timestamp();
+
+  /// constructor from seconds since 1970-01-01 00:00:00 UTC
+  explicit Timestamp(long long secondsSinceEpoch);
+
+  /// constructor from DateTime, uses the assumed base year if the date has none
+  explicit Timestamp(const DateTime& dateTime);
+
+  /// constructor from calendar fields in UTC, hour may be 24 and minute may be 60 as in EnergyPlus output,
+  /// throws if the month or day is not valid in year
+  Timestamp(int year, unsigned month, unsigned day, int hour = 0, int minute = 0, int second = 0);
+
+  /// seconds since 1970-01-01 00:00:00 UTC
+  long long secondsSinceEpoch() const { return m_seconds; }
+
+  /// convert to a UTC DateTime with a base year
+  DateTime dateTime() const;
+
+  /// addition of seconds
+  Timestamp operator+ (long long seconds) const { return Timestamp(m_seconds + seconds); }
+
+  /// subtraction of seconds
+  Timestamp operator- (long long seconds) const { return Timestamp(m_seconds - seconds); }
+
+  /// difference in seconds
+  long long operator- (const Timestamp& other) const { return m_seconds - other.m_seconds; }
+
+  bool operator== (const Timestamp& other) const { return m_seconds == other.m_seconds; }
+  bool operator!= (const Timestamp& other) const { return m_seconds != other.m_seconds; }
+  bool operator< (const Timestamp& other) const { return m_seconds < other.m_seconds; }
+  bool operator<= (const Timestamp& other) const { return m_seconds <= other.m_seconds; }
+  bool operator> (const Timestamp& other) const { return m_seconds > other.m_seconds; }
+  bool operator>= (const Timestamp& other) const { return m_seconds >= other.m_seconds; }
+
+ private:
+
+  long long m_seconds;
+};
+
+/// vector of Timestamp
+typedef std::vector<Timestamp> TimestampVector;
+
+/// Converts columns of calendar fields to timestamps in a single pass without building Date or DateTime
+/// objects. All columns must have the same length. If wrapAround is true, the year is advanced each time
+/// an entry would otherwise fall before its predecessor, e.g. for weather data starting mid year.
+/// Throws if the columns differ in length or contain an invalid month or day.
+UTILITIES_API TimestampVector toTimestamps(int year, const std::vector<unsigned>& months, const std::vector<unsigned>& days,
+  const std::vector<int>& hours, const std::vector<int>& minutes, bool wrapAround = false);
+
+/// convert a vector of DateTime to Timestamp
+UTILITIES_API TimestampVector toTimestamps(const DateTimeVector& dateTimes);
+
+/// convert a vector of Timestamp to UTC DateTime
+UTILITIES_API DateTimeVector toDateTimes(const TimestampVector& timestamps);
+
+// std::ostream operator<<
+UTILITIES_API std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp);
+
+} // openstudio
+
+#endif // UTILITIES_TIME_TIMESTAMP_HPP
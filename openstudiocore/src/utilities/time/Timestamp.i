@@ -0,0 +1,27 @@
+#ifndef UTILITIES_TIME_TIMESTAMP_I
+#define UTILITIES_TIME_TIMESTAMP_I
+
+%{
+  #include <utilities/time/Timestamp.hpp>
+%}
+
+// create an instantiation of the vector class
+%template(TimestampVector) std::vector< openstudio::Timestamp >;
+
+// Ignore streaming operations
+%ignore operator<<(std::ostream&, const openstudio::Timestamp& );
+
+// include the header into the swig interface directly
+%include <utilities/time/Timestamp.hpp>
+
+%extend openstudio::Timestamp{
+
+  std::string __str__() const{
+    std::ostringstream os;
+    os << *self;
+    return os.str();
+  }
+
+};
+
+#endif //UTILITIES_TIME_TIMESTAMP_I
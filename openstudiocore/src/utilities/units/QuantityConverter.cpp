@@ -45,6 +45,11 @@
 
 #include "../core/Assert.hpp"
 
+#include <QReadWriteLock>
+
+#include <algorithm>
+#include <cmath>
+
 namespace openstudio {
 
 boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &q,
@@ -126,7 +131,150 @@ boost::optional<Quantity> QuantityConverterSingleton::convert(const Quantity &or
   return result;
 }
 
+boost::optional<double> QuantityConverterSingleton::convert(double original,
+                                                            const std::string& originalUnits,
+                                                            const std::string& finalUnits) const
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
+
+  AffineConversion conversion = m_affineConversion(originalUnits,finalUnits);
+  if (!conversion.valid) {
+    return boost::none;
+  }
+  if (conversion.affine) {
+    return conversion.factor * original + conversion.offset;
+  }
+  return m_convertValue(original,originalUnits,finalUnits);
+}
+
+std::vector<double> QuantityConverterSingleton::convert(const std::vector<double>& original,
+                                                        const std::string& originalUnits,
+                                                        const std::string& finalUnits) const
+{
+  if (originalUnits == finalUnits){
+    return original;
+  }
+
+  std::vector<double> result;
+  AffineConversion conversion = m_affineConversion(originalUnits,finalUnits);
+  if (!conversion.valid) {
+    return result;
+  }
+
+  result.resize(original.size());
+  if (conversion.affine) {
+    for (unsigned i = 0, n = original.size(); i < n; ++i) {
+      result[i] = conversion.factor * original[i] + conversion.offset;
+    }
+  }
+  else {
+    for (unsigned i = 0, n = original.size(); i < n; ++i) {
+      boost::optional<double> value = m_convertValue(original[i],originalUnits,finalUnits);
+      OS_ASSERT(value);
+      result[i] = *value;
+    }
+  }
+  return result;
+}
+
+boost::optional<std::pair<double,double> > QuantityConverterSingleton::affineConversion(
+    const std::string& originalUnits,
+    const std::string& finalUnits) const
+{
+  if (originalUnits == finalUnits){
+    return std::make_pair(1.0,0.0);
+  }
+
+  AffineConversion conversion = m_affineConversion(originalUnits,finalUnits);
+  if (conversion.valid && conversion.affine) {
+    return std::make_pair(conversion.factor,conversion.offset);
+  }
+  return boost::none;
+}
+
+QuantityConverterSingleton::AffineConversion QuantityConverterSingleton::m_affineConversion(
+    const std::string& originalUnits,
+    const std::string& finalUnits) const
+{
+  std::pair<std::string,std::string> key(originalUnits,finalUnits);
+  {
+    QReadLocker l(m_mutex);
+    auto it = m_affineConversions.find(key);
+    if (it != m_affineConversions.end()) {
+      return it->second;
+    }
+  }
+
+  // UnitFactory is not thread safe, so misses are computed one at a time
+  QWriteLocker l(m_mutex);
+  auto it = m_affineConversions.find(key);
+  if (it != m_affineConversions.end()) {
+    return it->second;
+  }
+
+  AffineConversion result;
+  result.valid = false;
+  result.affine = false;
+  result.factor = 1.0;
+  result.offset = 0.0;
+
+  // fit factor and offset from two widely spaced points to limit round off, and check two more
+  boost::optional<double> zero = m_convertValue(0.0,originalUnits,finalUnits);
+  boost::optional<double> million = m_convertValue(1.0E6,originalUnits,finalUnits);
+  if (zero && million) {
+    result.valid = true;
+    result.offset = *zero;
+    result.factor = (*million - *zero) / 1.0E6;
+    result.affine = true;
+    for (double x : {1.0, 100.0}) {
+      boost::optional<double> value = m_convertValue(x,originalUnits,finalUnits);
+      OS_ASSERT(value);
+      double predicted = result.factor * x + result.offset;
+      if (std::fabs(predicted - *value) > 1.0E-12 * std::max(1.0,std::fabs(*value))) {
+        result.affine = false;
+      }
+    }
+  }
+
+  m_affineConversions[key] = result;
+  return result;
+}
+
+boost::optional<double> QuantityConverterSingleton::m_convertValue(double original,
+                                                                   const std::string& originalUnits,
+                                                                   const std::string& finalUnits) const
+{
+  //create the units from the strings
+  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+
+  //make sure both unit strings were valid
+  if (originalUnit && finalUnit) {
+
+    //make the original quantity
+    Quantity originalQuant = Quantity(original, *originalUnit);
+
+    //convert to final units
+    boost::optional<Quantity> finalQuant = convert(originalQuant, *finalUnit);
+
+    //if the conversion
+    if (finalQuant) {
+      return finalQuant->value();
+    }
+  }
+
+  return boost::none;
+}
+
+QuantityConverterSingleton::~QuantityConverterSingleton()
+{
+  delete m_mutex;
+}
+
 QuantityConverterSingleton::QuantityConverterSingleton()
+  : m_mutex(new QReadWriteLock())
 {
   // initialize the quantity converter maps here
 
@@ -509,30 +657,12 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(
 
 boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits)
 {
-  if (originalUnits == finalUnits){
-    return original;
-  }
-
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
-
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
-
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
-
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
-
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
-    }
-  }
+  return QuantityConverter::instance().convert(original,originalUnits,finalUnits);
+}
 
-  return boost::none;
+std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits)
+{
+  return QuantityConverter::instance().convert(original,originalUnits,finalUnits);
 }
 
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
@@ -37,8 +37,10 @@
 #include "Unit.hpp"
 #include <string>
 #include <map>
+#include <vector>
 
 class QDomElement;
+class QReadWriteLock;
 
 namespace openstudio {
 
@@ -96,10 +98,51 @@ class UTILITIES_API QuantityConverterSingleton {
 
   boost::optional<Quantity> convert(const Quantity &original, const Unit& targetUnits) const;
 
+  /** Converts original from originalUnits to finalUnits. The conversion for each pair of unit
+   *  strings is computed once and cached as a factor and offset, so repeated calls do not parse
+   *  units. Concurrent calls are serialized while a new pair is computed, but the computation
+   *  uses UnitFactory, so other threads must not use UnitFactory at the same time. */
+  boost::optional<double> convert(double original,
+                                  const std::string& originalUnits,
+                                  const std::string& finalUnits) const;
+
+  /** Converts all values from originalUnits to finalUnits. Returns an empty vector if the units
+   *  cannot be converted. */
+  std::vector<double> convert(const std::vector<double>& original,
+                              const std::string& originalUnits,
+                              const std::string& finalUnits) const;
+
+  /** Returns the factor and offset such that a value in finalUnits is factor * (value in
+   *  originalUnits) + offset. Returns boost::none if the units cannot be converted, or if the
+   *  conversion is not affine (for instance, absolute temperatures raised to a power). */
+  boost::optional<std::pair<double,double> > affineConversion(const std::string& originalUnits,
+                                                              const std::string& finalUnits) const;
+
+  ~QuantityConverterSingleton();
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
 
+  struct AffineConversion {
+    bool valid;
+    bool affine;
+    double factor;
+    double offset;
+  };
+
+  typedef std::map<std::pair<std::string,std::string>, AffineConversion> AffineConversionMap;
+
+  mutable AffineConversionMap m_affineConversions;
+  mutable QReadWriteLock* m_mutex;
+
+  AffineConversion m_affineConversion(const std::string& originalUnits,
+                                      const std::string& finalUnits) const;
+
+  boost::optional<double> m_convertValue(double original,
+                                         const std::string& originalUnits,
+                                         const std::string& finalUnits) const;
+
   typedef std::map<std::string, baseUnitConversionFactor> BaseUnitConversionMap;
   typedef std::multimap<UnitSystem, baseUnitConversionFactor> UnitSystemConversionMultiMap;
 
@@ -121,6 +164,10 @@ typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts an entire vector of values using one cached factor and
+ *  offset. Returns an empty vector if the units cannot be converted. \relates QuantityConverterSingleton */
+UTILITIES_API std::vector<double> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
@@ -268,3 +268,45 @@ TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
 TEST_F(UnitsFixture,QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector,UnitSystem(UnitSystem::Wh));
 }
+
+TEST_F(UnitsFixture,QuantityConverter_UnitStrings) {
+  // absolute temperatures have an offset
+  boost::optional<double> value = convert(100.0,"C","F");
+  ASSERT_TRUE(value);
+  EXPECT_NEAR(212.0,value.get(),1.0E-10);
+  value = convert(-40.0,"C","F");
+  ASSERT_TRUE(value);
+  EXPECT_NEAR(-40.0,value.get(),1.0E-10);
+
+  boost::optional<std::pair<double,double> > conversion = QuantityConverter::instance().affineConversion("C","F");
+  ASSERT_TRUE(conversion);
+  EXPECT_DOUBLE_EQ(1.8,conversion->first);
+  EXPECT_DOUBLE_EQ(32.0,conversion->second);
+
+  conversion = QuantityConverter::instance().affineConversion("m","ft");
+  ASSERT_TRUE(conversion);
+  EXPECT_NEAR(3.28084,conversion->first,1.0E-5);
+  EXPECT_DOUBLE_EQ(0.0,conversion->second);
+
+  // vectors use the same cached conversion
+  std::vector<double> values;
+  values.push_back(0.0);
+  values.push_back(1.0);
+  values.push_back(2.5);
+  std::vector<double> result = convert(values,"m","ft");
+  ASSERT_EQ(3u,result.size());
+  for (unsigned i = 0; i < 3; ++i) {
+    value = convert(values[i],"m","ft");
+    ASSERT_TRUE(value);
+    EXPECT_DOUBLE_EQ(value.get(),result[i]);
+  }
+
+  // invalid units
+  EXPECT_FALSE(convert(1.0,"m","kg"));
+  EXPECT_FALSE(QuantityConverter::instance().affineConversion("m","kg"));
+  EXPECT_TRUE(convert(values,"m","kg").empty());
+
+  // same units are returned unchanged
+  result = convert(values,"m","m");
+  EXPECT_TRUE(result == values);
+}